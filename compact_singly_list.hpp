@@ -0,0 +1,760 @@
+#ifndef COMPACT_SINGLY_LIST_HPP
+#define COMPACT_SINGLY_LIST_HPP
+
+#include <cstddef>
+#include <memory>
+#include <initializer_list>
+#include <stdexcept>
+#include <string>
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <compare>
+#include <concepts>
+#include <limits>
+#include <utility>
+
+
+namespace adt {
+
+    // A singly linked list that keeps no more state than a pointer to its first node: the before-begin sentinel is a
+    // bare link (no dummy element, so `T` needs no default constructor), and the allocator takes no space when it is
+    // empty. With std::allocator an empty list is one pointer, where an adt::singly_list also carries a dummy element,
+    // a head and a tail pointer, two allocators and a size. Like std::forward_list, it keeps neither a size nor a tail,
+    // so it has no size(), back() nor push_back(); splicing a range still takes time linear in its length
+    template<class T, class Allocator = std::allocator<T>>
+    class compact_singly_list {
+    public:
+        /* -----------------------------------------------Definitions----------------------------------------------- */
+        using value_type = T;
+
+        using allocator_type = Allocator;
+
+        using size_type = std::size_t;
+
+        using difference_type = std::ptrdiff_t;
+
+        using reference = value_type&;
+
+        using const_reference = const value_type&;
+
+        using pointer = typename std::allocator_traits<allocator_type>::pointer;
+
+        using const_pointer = typename std::allocator_traits<allocator_type>::const_pointer;
+
+    private:
+        /* -------------------------------------------------Link---------------------------------------------------- */
+        // What the sentinel holds, and what every node starts with
+        struct _Link {
+            /* --------------------------------------------Fields--------------------------------------------------- */
+            _Link* next;
+        };
+
+        /* -------------------------------------------------Node---------------------------------------------------- */
+        struct _Node : _Link {
+            /* --------------------------------------------Fields--------------------------------------------------- */
+            value_type value;
+
+            /* -----------------------------------------Constructors------------------------------------------------ */
+            template<class... Args>
+            constexpr _Node(_Link* next, Args&&... args) : _Link{next}, value(std::forward<Args>(args)...) {}
+
+        };
+
+        /* ----------------------------------------------Definitions------------------------------------------------ */
+        using allocator_traits = typename std::allocator_traits<allocator_type>;
+
+        using _NodeAllocator = typename allocator_traits::template rebind_alloc<_Node>;
+
+        using node_allocator_traits = typename std::allocator_traits<_NodeAllocator>;
+
+        /* ------------------------------------------------Fields--------------------------------------------------- */
+        _Link head;
+
+        [[no_unique_address]] _NodeAllocator node_allocator;
+
+        /* ------------------------------------------------Methods-------------------------------------------------- */
+        [[nodiscard]] static constexpr reference _value(_Link* link) noexcept { return static_cast<_Node*>(link)->value; }
+
+        template<class... Args>
+        constexpr _Link* _insert_after(_Link* pos, Args&&... args) {
+            _Node* node = node_allocator_traits::allocate(this->node_allocator, 1);
+
+            try {
+                node_allocator_traits::construct(this->node_allocator, node, pos->next, std::forward<Args>(args)...);
+            } catch (...) {
+                node_allocator_traits::deallocate(this->node_allocator, node, 1);
+                throw;
+            }
+
+            pos->next = node;
+            return node;
+        }
+
+        constexpr void _delete_node(_Link* link) noexcept {
+            _Node* node = static_cast<_Node*>(link);
+            node_allocator_traits::destroy(this->node_allocator, node);
+            node_allocator_traits::deallocate(this->node_allocator, node, 1);
+        }
+
+        // Deletes the nodes in (`first`, `last`)
+        constexpr void _erase_after(_Link* first, _Link* last) noexcept {
+            _Link* curr = first->next;
+
+            while (curr != last) {
+                _Link* next = curr->next;
+                this->_delete_node(curr);
+                curr = next;
+            }
+
+            first->next = last;
+        }
+
+        // Appends copies (or moves) of [`first`, `last`) after `pos`. Returns the last node inserted, or `pos`
+        template<std::input_iterator InputIt>
+        constexpr _Link* _insert_range_after(_Link* pos, InputIt first, InputIt last) {
+            for (; first != last; ++first) {
+                pos = this->_insert_after(pos, *first);
+            }
+
+            return pos;
+        }
+
+        // Moves the elements of `other`, whose allocator cannot free our nodes, one by one, leaving it empty
+        constexpr void _move_elements(compact_singly_list& other) {
+            _Link* prev = &this->head;
+
+            for (_Link* curr = other.head.next; curr != nullptr; curr = curr->next) {
+                prev = this->_insert_after(prev, std::move(_value(curr)));
+            }
+            other.clear();
+        }
+
+        [[nodiscard]] constexpr bool _is_allocator_equal(const compact_singly_list& other) const noexcept {
+            if constexpr (allocator_traits::is_always_equal::value) {
+                return true;
+            } else {
+                return this->node_allocator == other.node_allocator;
+            }
+        }
+
+        template<class Compare>
+        static constexpr _Link* _merge_sort_merge(_Link* first_half, _Link* second_half, Compare& comp) noexcept {
+            _Link merged{nullptr};
+            _Link* link = &merged;
+
+            // While both halves have elements left to merge...
+            while (first_half != nullptr && second_half != nullptr) {
+                // Take from `second_half` only if it strictly precedes `first_half` to keep the merge stable
+                if (comp(_value(second_half), _value(first_half))) {
+                    link->next = second_half;
+                    second_half = second_half->next;
+                } else {
+                    link->next = first_half;
+                    first_half = first_half->next;
+                }
+
+                link = link->next;
+            }
+
+            // Append whatever remains of the half that was not exhausted
+            link->next = (first_half != nullptr) ? first_half : second_half;
+
+            return merged.next;
+        }
+
+        // Bottom-up merge sort, as in adt::singly_list
+        template<class Compare>
+        static constexpr _Link* _merge_sort(_Link* link, Compare& comp) noexcept {
+            // `runs[i]` holds either nullptr or a sorted run of exactly 2^i elements. Runs in higher slots always hold
+            // elements that appeared earlier in the list, which keeps the sort stable
+            _Link* runs[std::numeric_limits<size_type>::digits] = {};
+            _Link* carry;
+            size_type i;
+
+            while (link != nullptr) {
+                // Detach the next element as a sorted run of length 1
+                carry = link;
+                link = link->next;
+                carry->next = nullptr;
+
+                // Merge `carry` with every occupied slot, like propagating a carry in binary addition
+                for (i = 0; runs[i] != nullptr; i++) {
+                    carry = _merge_sort_merge(runs[i], carry, comp);
+                    runs[i] = nullptr;
+                }
+                runs[i] = carry;
+            }
+
+            // Merge the remaining runs from the latest (lowest slot) to the earliest (highest slot)
+            carry = nullptr;
+            for (i = 0; i < std::numeric_limits<size_type>::digits; i++) {
+                if (runs[i] != nullptr) {
+                    carry = _merge_sort_merge(runs[i], carry, comp);
+                }
+            }
+
+            return carry;
+        }
+
+    public:
+        /* -----------------------------------------------Iterators------------------------------------------------- */
+        class iterator;
+
+        class const_iterator {
+        private:
+            /* ---------------------------------------------Fields-------------------------------------------------- */
+            const compact_singly_list* parent;
+
+            _Link* node;
+
+            /* -------------------------------------------Constructors---------------------------------------------- */
+            constexpr const_iterator(const compact_singly_list* parent, _Link* node) noexcept
+                : parent(parent), node(node) {}
+
+            /* ---------------------------------------------Methods------------------------------------------------- */
+            [[nodiscard]] constexpr bool _is_dereferenceable() const noexcept {
+                return this->node != nullptr && this->node != &this->parent->head;
+            }
+
+            /* ---------------------------------------------Friends------------------------------------------------- */
+            friend class compact_singly_list;
+
+            friend class iterator;
+
+        public:
+            /* -------------------------------------------Definitions----------------------------------------------- */
+            using iterator_category = std::forward_iterator_tag;
+
+            using value_type = typename compact_singly_list::value_type;
+
+            using difference_type = typename compact_singly_list::difference_type;
+
+            using reference = const value_type&;
+
+            using pointer = const value_type*;
+
+            /* ------------------------------------------Constructors----------------------------------------------- */
+            constexpr const_iterator() noexcept : parent(nullptr), node(nullptr) {}
+
+            /* ---------------------------------------Overloaded Operators------------------------------------------ */
+            [[nodiscard]] constexpr reference operator*() const {
+                if (!this->_is_dereferenceable()) {
+                    throw std::runtime_error("segmentation fault");
+                }
+                return _value(this->node);
+            }
+
+            [[nodiscard]] constexpr pointer operator->() const { return &(**this); }
+
+            constexpr const_iterator& operator++() {
+                if (this->node == nullptr) {
+                    throw std::runtime_error("segmentation fault");
+                }
+                this->node = this->node->next;
+                return *this;
+            }
+
+            constexpr const_iterator operator++(int) {
+                const_iterator temp = *this;
+                ++(*this);
+                return temp;
+            }
+
+            [[nodiscard]] constexpr bool operator==(const const_iterator& rhs) const noexcept {
+                return this->node == rhs.node;
+            }
+
+        };
+
+        class iterator {
+        private:
+            /* ---------------------------------------------Fields-------------------------------------------------- */
+            const compact_singly_list* parent;
+
+            _Link* node;
+
+            /* -------------------------------------------Constructors---------------------------------------------- */
+            constexpr iterator(const compact_singly_list* parent, _Link* node) noexcept : parent(parent), node(node) {}
+
+            /* ---------------------------------------------Friends------------------------------------------------- */
+            friend class compact_singly_list;
+
+        public:
+            /* -------------------------------------------Definitions----------------------------------------------- */
+            using iterator_category = std::forward_iterator_tag;
+
+            using value_type = typename compact_singly_list::value_type;
+
+            using difference_type = typename compact_singly_list::difference_type;
+
+            using reference = value_type&;
+
+            using pointer = value_type*;
+
+            /* ------------------------------------------Constructors----------------------------------------------- */
+            constexpr iterator() noexcept : parent(nullptr), node(nullptr) {}
+
+            /* ---------------------------------------Overloaded Operators------------------------------------------ */
+            [[nodiscard]] constexpr reference operator*() const {
+                if (!const_iterator(*this)._is_dereferenceable()) {
+                    throw std::runtime_error("segmentation fault");
+                }
+                return _value(this->node);
+            }
+
+            [[nodiscard]] constexpr pointer operator->() const { return &(**this); }
+
+            constexpr iterator& operator++() {
+                if (this->node == nullptr) {
+                    throw std::runtime_error("segmentation fault");
+                }
+                this->node = this->node->next;
+                return *this;
+            }
+
+            constexpr iterator operator++(int) {
+                iterator temp = *this;
+                ++(*this);
+                return temp;
+            }
+
+            [[nodiscard]] constexpr bool operator==(const iterator& rhs) const noexcept {
+                return this->node == rhs.node;
+            }
+
+            [[nodiscard]] constexpr operator const_iterator() const noexcept {
+                return const_iterator(this->parent, this->node);
+            }
+
+        };
+
+    private:
+        /* ------------------------------------------------Methods-------------------------------------------------- */
+        constexpr void _check_position(const const_iterator& pos, const char* method) const {
+            if (pos.node == nullptr) {
+                throw std::runtime_error("segmentation fault");
+            }
+
+            if (pos.parent != this) {
+                throw std::invalid_argument(
+                    std::string(method) +
+                    "() error: \"pos\" must belong to the same instance of adt::compact_singly_list as *this"
+                );
+            }
+        }
+
+    public:
+        /* ----------------------------------------------Constructors----------------------------------------------- */
+        constexpr compact_singly_list() noexcept(noexcept(allocator_type())) : compact_singly_list(allocator_type()) {}
+
+        explicit constexpr compact_singly_list(const allocator_type& allocator) noexcept
+            : head{nullptr}, node_allocator(allocator) {}
+
+        explicit constexpr compact_singly_list(size_type size, const allocator_type& allocator = allocator_type())
+            : compact_singly_list(allocator) {
+            _Link* prev = &this->head;
+            for (size_type i = 0; i < size; i++) {
+                prev = this->_insert_after(prev);
+            }
+        }
+
+        constexpr compact_singly_list(size_type size, const_reference value,
+                                      const allocator_type& allocator = allocator_type())
+            : compact_singly_list(allocator) {
+            this->insert_after(this->before_begin(), size, value);
+        }
+
+        template<std::input_iterator InputIt>
+        constexpr compact_singly_list(InputIt first, InputIt last, const allocator_type& allocator = allocator_type())
+            : compact_singly_list(allocator) {
+            this->_insert_range_after(&this->head, first, last);
+        }
+
+        constexpr compact_singly_list(std::initializer_list<value_type> values,
+                                      const allocator_type& allocator = allocator_type())
+            : compact_singly_list(values.begin(), values.end(), allocator) {}
+
+        constexpr compact_singly_list(const compact_singly_list& other)
+            : compact_singly_list(other.begin(), other.end(),
+                                  allocator_traits::select_on_container_copy_construction(other.get_allocator())) {}
+
+        // Steals the nodes of `other` without allocating, leaving it empty
+        constexpr compact_singly_list(compact_singly_list&& other) noexcept
+            : head{std::exchange(other.head.next, nullptr)}, node_allocator(other.node_allocator) {}
+
+        /* -----------------------------------------------Destructor------------------------------------------------ */
+        constexpr ~compact_singly_list() noexcept { this->clear(); }
+
+        /* ------------------------------------------Overloaded Operators------------------------------------------- */
+        constexpr compact_singly_list& operator=(const compact_singly_list& rhs) {
+            if (this == &rhs) {
+                return *this;
+            }
+
+            if constexpr (allocator_traits::propagate_on_container_copy_assignment::value) {
+                if (!this->_is_allocator_equal(rhs)) {
+                    this->clear();
+                }
+                this->node_allocator = rhs.node_allocator;
+            }
+
+            this->assign(rhs.begin(), rhs.end());
+            return *this;
+        }
+
+        constexpr compact_singly_list& operator=(compact_singly_list&& rhs)
+            noexcept(allocator_traits::propagate_on_container_move_assignment::value ||
+                     allocator_traits::is_always_equal::value) {
+            if (this == &rhs) {
+                return *this;
+            }
+
+            this->clear();
+
+            if constexpr (allocator_traits::propagate_on_container_move_assignment::value) {
+                this->node_allocator = rhs.node_allocator;
+            } else if (!this->_is_allocator_equal(rhs)) {
+                this->_move_elements(rhs);
+                return *this;
+            }
+
+            this->head.next = std::exchange(rhs.head.next, nullptr);
+            return *this;
+        }
+
+        constexpr compact_singly_list& operator=(std::initializer_list<value_type> values) {
+            this->assign(values.begin(), values.end());
+            return *this;
+        }
+
+        [[nodiscard]] constexpr bool operator==(const compact_singly_list& rhs) const {
+            return std::equal(this->begin(), this->end(), rhs.begin(), rhs.end());
+        }
+
+        [[nodiscard]] constexpr auto operator<=>(const compact_singly_list& rhs) const
+            requires (std::three_way_comparable<value_type>) {
+            return std::lexicographical_compare_three_way(this->begin(), this->end(), rhs.begin(), rhs.end());
+        }
+
+        /* ------------------------------------------------Methods-------------------------------------------------- */
+        [[nodiscard]] constexpr iterator before_begin() noexcept { return iterator(this, &this->head); }
+
+        [[nodiscard]] constexpr const_iterator before_begin() const noexcept {
+            return const_iterator(this, const_cast<_Link*>(&this->head));
+        }
+
+        [[nodiscard]] constexpr const_iterator cbefore_begin() const noexcept { return this->before_begin(); }
+
+        [[nodiscard]] constexpr iterator begin() noexcept { return iterator(this, this->head.next); }
+
+        [[nodiscard]] constexpr const_iterator begin() const noexcept { return const_iterator(this, this->head.next); }
+
+        [[nodiscard]] constexpr const_iterator cbegin() const noexcept { return this->begin(); }
+
+        [[nodiscard]] constexpr iterator end() noexcept { return iterator(this, nullptr); }
+
+        [[nodiscard]] constexpr const_iterator end() const noexcept { return const_iterator(this, nullptr); }
+
+        [[nodiscard]] constexpr const_iterator cend() const noexcept { return this->end(); }
+
+        // Overwrites the existing elements in place, creates only the elements missing and deletes only those left over
+        template<std::input_iterator InputIt>
+        constexpr void assign(InputIt first, InputIt last) {
+            _Link* prev = &this->head;
+
+            for (; first != last && prev->next != nullptr; ++first) {
+                prev = prev->next;
+                _value(prev) = *first;
+            }
+
+            if (first != last) {
+                this->_insert_range_after(prev, first, last);
+            } else {
+                this->_erase_after(prev, nullptr);
+            }
+        }
+
+        constexpr void assign(std::initializer_list<value_type> values) { this->assign(values.begin(), values.end()); }
+
+        [[nodiscard]] constexpr allocator_type get_allocator() const noexcept {
+            return allocator_type(this->node_allocator);
+        }
+
+        [[nodiscard]] constexpr reference front() {
+            if (this->head.next != nullptr) {
+                return _value(this->head.next);
+            }
+            throw std::runtime_error("segmentation fault");
+        }
+
+        [[nodiscard]] constexpr const_reference front() const {
+            return const_cast<compact_singly_list*>(this)->front();
+        }
+
+        [[nodiscard]] constexpr bool empty() const noexcept { return this->head.next == nullptr; }
+
+        [[nodiscard]] constexpr size_type max_size() const noexcept {
+            return std::min<size_type>(node_allocator_traits::max_size(this->node_allocator),
+                                       std::numeric_limits<difference_type>::max());
+        }
+
+        constexpr void clear() noexcept { this->_erase_after(&this->head, nullptr); }
+
+        template<class... Args>
+        constexpr reference emplace_front(Args&&... args) {
+            return _value(this->_insert_after(&this->head, std::forward<Args>(args)...));
+        }
+
+        constexpr void push_front(const_reference value) { this->emplace_front(value); }
+
+        constexpr void push_front(value_type&& value) { this->emplace_front(std::move(value)); }
+
+        constexpr void pop_front() {
+            if (this->head.next == nullptr) {
+                throw std::runtime_error("cannot pop from an empty list");
+            }
+
+            this->_erase_after(&this->head, this->head.next->next);
+        }
+
+        template<class... Args>
+        constexpr iterator emplace_after(const_iterator pos, Args&&... args) {
+            this->_check_position(pos, "emplace_after");
+            return iterator(this, this->_insert_after(pos.node, std::forward<Args>(args)...));
+        }
+
+        constexpr iterator insert_after(const_iterator pos, const_reference value) {
+            this->_check_position(pos, "insert_after");
+            return iterator(this, this->_insert_after(pos.node, value));
+        }
+
+        constexpr iterator insert_after(const_iterator pos, value_type&& value) {
+            this->_check_position(pos, "insert_after");
+            return iterator(this, this->_insert_after(pos.node, std::move(value)));
+        }
+
+        // Inserts `count` copies of `value` after `pos`. Returns the position of the last one, or `pos` if `count` is 0
+        constexpr iterator insert_after(const_iterator pos, size_type count, const_reference value) {
+            this->_check_position(pos, "insert_after");
+
+            _Link* prev = pos.node;
+            for (size_type i = 0; i < count; i++) {
+                prev = this->_insert_after(prev, value);
+            }
+
+            return iterator(this, prev);
+        }
+
+        // Inserts [`first`, `last`) after `pos`. Returns the position of the last element inserted, or `pos`
+        template<std::input_iterator InputIt>
+        constexpr iterator insert_after(const_iterator pos, InputIt first, InputIt last) {
+            this->_check_position(pos, "insert_after");
+            return iterator(this, this->_insert_range_after(pos.node, first, last));
+        }
+
+        constexpr iterator insert_after(const_iterator pos, std::initializer_list<value_type> values) {
+            return this->insert_after(pos, values.begin(), values.end());
+        }
+
+        // Erases the element after `pos`. Returns the position of the element that followed it
+        constexpr iterator erase_after(const_iterator pos) {
+            this->_check_position(pos, "erase_after");
+
+            if (pos.node->next == nullptr) {
+                throw std::runtime_error("segmentation fault");
+            }
+
+            this->_erase_after(pos.node, pos.node->next->next);
+            return iterator(this, pos.node->next);
+        }
+
+        // Erases the elements in (`first`, `last`). Returns `last`
+        constexpr iterator erase_after(const_iterator first, const_iterator last) {
+            this->_check_position(first, "erase_after");
+
+            this->_erase_after(first.node, last.node);
+            return iterator(this, last.node);
+        }
+
+        // Moves every element of `other` after `pos` by relinking its nodes. Takes time linear in the length of
+        // `other`, to find its last node
+        constexpr void splice_after(const_iterator pos, compact_singly_list& other) {
+            if (this == &other) {
+                throw std::invalid_argument("splice_after() error: \"other\" and \"*this\" cannot be from the same instance");
+            }
+
+            this->splice_after(pos, other, other.before_begin(), other.end());
+        }
+
+        constexpr void splice_after(const_iterator pos, compact_singly_list&& other) { this->splice_after(pos, other); }
+
+        // Moves the element after `it` in `other` (which may be `*this`) after `pos` in O(1)
+        constexpr void splice_after(const_iterator pos, compact_singly_list& other, const_iterator it) {
+            this->_check_position(pos, "splice_after");
+            other._check_position(it, "splice_after");
+
+            if (!this->_is_allocator_equal(other)) {
+                throw std::invalid_argument("splice_after() error: \"other\" must have an allocator equal to *this");
+            }
+
+            // Splicing an element after itself or after its own predecessor leaves the list unchanged
+            if (it.node->next == nullptr || pos.node == it.node || pos.node == it.node->next) {
+                return;
+            }
+
+            _Link* moved = it.node->next;
+            it.node->next = moved->next;
+            moved->next = pos.node->next;
+            pos.node->next = moved;
+        }
+
+        constexpr void splice_after(const_iterator pos, compact_singly_list&& other, const_iterator it) {
+            this->splice_after(pos, other, it);
+        }
+
+        // Moves the elements in (`first`, `last`) of `other` (which may be `*this`, as long as `pos` is not one of
+        // them) after `pos`. Takes time linear in the number of elements moved, to find the last of them
+        constexpr void splice_after(const_iterator pos, compact_singly_list& other, const_iterator first,
+                                    const_iterator last) {
+            this->_check_position(pos, "splice_after");
+            other._check_position(first, "splice_after");
+
+            if (!this->_is_allocator_equal(other)) {
+                throw std::invalid_argument("splice_after() error: \"other\" must have an allocator equal to *this");
+            }
+
+            if (first.node->next == last.node) {
+                return;
+            }
+
+            _Link* chain_first = first.node->next,
+                 * chain_last = chain_first;
+
+            while (chain_last->next != last.node) {
+                chain_last = chain_last->next;
+            }
+
+            first.node->next = last.node;
+            chain_last->next = pos.node->next;
+            pos.node->next = chain_first;
+        }
+
+        constexpr void splice_after(const_iterator pos, compact_singly_list&& other, const_iterator first,
+                                    const_iterator last) {
+            this->splice_after(pos, other, first, last);
+        }
+
+        constexpr size_type remove(const_reference value) {
+            return this->remove_if([&](const_reference element) -> bool { return element == value; });
+        }
+
+        template<class Predicate>
+        constexpr size_type remove_if(Predicate pred) requires (std::predicate<Predicate&, const_reference>) {
+            _Link* prev = &this->head;
+            size_type removed = 0;
+
+            while (prev->next != nullptr) {
+                if (pred(std::as_const(_value(prev->next)))) {
+                    this->_erase_after(prev, prev->next->next);
+                    removed++;
+                } else {
+                    prev = prev->next;
+                }
+            }
+
+            return removed;
+        }
+
+        constexpr size_type unique() { return this->unique(std::equal_to<value_type>{}); }
+
+        // Erases every element equal to the one before it. Returns the number of elements erased
+        template<class BinaryPredicate>
+        constexpr size_type unique(BinaryPredicate pred)
+            requires (std::predicate<BinaryPredicate&, const_reference, const_reference>) {
+            if (this->head.next == nullptr) {
+                return 0;
+            }
+
+            _Link* node = this->head.next;
+            size_type removed = 0;
+
+            while (node->next != nullptr) {
+                if (pred(std::as_const(_value(node)), std::as_const(_value(node->next)))) {
+                    this->_erase_after(node, node->next->next);
+                    removed++;
+                } else {
+                    node = node->next;
+                }
+            }
+
+            return removed;
+        }
+
+        constexpr void reverse() noexcept {
+            _Link* prev = nullptr,
+                 * curr = this->head.next,
+                 * next;
+
+            while (curr != nullptr) {
+                next = curr->next;
+                curr->next = prev;
+                prev = curr;
+                curr = next;
+            }
+
+            this->head.next = prev;
+        }
+
+        constexpr void sort() { this->sort(std::less<value_type>{}); }
+
+        // Stable merge sort that only relinks the nodes
+        template<class Compare>
+        constexpr void sort(Compare comp) { this->head.next = _merge_sort(this->head.next, comp); }
+
+        constexpr void merge(compact_singly_list& other) { this->merge(other, std::less<value_type>{}); }
+
+        constexpr void merge(compact_singly_list&& other) { this->merge(other, std::less<value_type>{}); }
+
+        // Merges the sorted list `other` into this sorted list by relinking nodes, leaving `other` empty. The merge is
+        // stable: of equivalent elements, those already in `*this` come first
+        template<class Compare>
+        constexpr void merge(compact_singly_list& other, Compare comp) {
+            if (this == &other || other.head.next == nullptr) {
+                return;
+            }
+
+            // If the allocators differ, the nodes of `other` cannot change owners, so merge a copy made with ours
+            if (!this->_is_allocator_equal(other)) {
+                compact_singly_list temp(this->get_allocator());
+                temp._move_elements(other);
+                this->merge(temp, comp);
+                return;
+            }
+
+            this->head.next = _merge_sort_merge(this->head.next, std::exchange(other.head.next, nullptr), comp);
+        }
+
+        template<class Compare>
+        constexpr void merge(compact_singly_list&& other, Compare comp) { this->merge(other, comp); }
+
+        constexpr void swap(compact_singly_list& other) noexcept {
+            if constexpr (allocator_traits::propagate_on_container_swap::value) {
+                std::swap(this->node_allocator, other.node_allocator);
+            }
+
+            std::swap(this->head.next, other.head.next);
+        }
+
+    };
+
+    /* ----------------------------------------Non-Member Functions------------------------------------------------- */
+    template<class T, class Allocator>
+    constexpr void swap(compact_singly_list<T, Allocator>& lhs, compact_singly_list<T, Allocator>& rhs) noexcept {
+        lhs.swap(rhs);
+    }
+
+} // adt
+
+
+#endif // COMPACT_SINGLY_LIST_HPP
@@ -0,0 +1,58 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+#include <forward_list> // baseline to compare against
+
+#include "singly_list.hpp"
+#include "compact_singly_list.hpp"
+
+
+/* -------------------------------------------Definitions---------------------------------------------------- */
+namespace {
+
+	// A 256-byte element, as kept in the buckets of a hash table
+	struct large {
+		std::int64_t key = 0;
+
+		char payload[248] = {};
+
+		large() = default;
+
+		large(std::int64_t key) : key(key) {}
+	};
+
+} // namespace
+
+/* -----------------------------------------Bucket Array Benchmarks------------------------------------------ */
+// Creates an array of `n` mostly empty buckets (one in 16 holds an element), then visits every element, as a chained
+// hash table does when it rehashes. The reported bytes_per_bucket is the size of an empty list
+template<class Container>
+static void bench_bucket_array(benchmark::State& state) {
+	const std::size_t n = static_cast<std::size_t>(state.range(0));
+
+	for (auto _ : state) {
+		std::vector<Container> buckets(n);
+
+		for (std::size_t i = 0; i < n; i += 16) {
+			buckets[i].push_front(large(static_cast<std::int64_t>(i)));
+		}
+
+		std::int64_t sum = 0;
+		for (const Container& bucket : buckets) {
+			for (const large& element : bucket) {
+				sum += element.key;
+			}
+		}
+		benchmark::DoNotOptimize(sum);
+	}
+
+	state.counters["bytes_per_bucket"] = static_cast<double>(sizeof(Container));
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(bench_bucket_array<adt::singly_list<large>>)->Name("bucket_array<adt::singly_list>")
+	->Arg(1'000)->Arg(100'000);
+BENCHMARK(bench_bucket_array<std::forward_list<large>>)->Name("bucket_array<std::forward_list>")
+	->Arg(1'000)->Arg(100'000);
+BENCHMARK(bench_bucket_array<adt::compact_singly_list<large>>)->Name("bucket_array<adt::compact_singly_list>")
+	->Arg(1'000)->Arg(100'000);
@@ -0,0 +1,324 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <memory> // to test move-only elements
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include "compact_singly_list.hpp"
+
+
+/* -------------------------------------------Definitions---------------------------------------------------- */
+namespace {
+
+	// Counts the calls to allocate() and deallocate() made by every copy of the allocator
+	template<class T>
+	struct counting_allocator {
+		using value_type = T;
+
+		static inline int allocations = 0;
+
+		static inline int deallocations = 0;
+
+		counting_allocator() = default;
+
+		template<class U>
+		counting_allocator(const counting_allocator<U>&) noexcept {}
+
+		T* allocate(std::size_t n) {
+			counting_allocator<char>::allocations++;
+			return std::allocator<T>().allocate(n);
+		}
+
+		void deallocate(T* ptr, std::size_t n) noexcept {
+			counting_allocator<char>::deallocations++;
+			std::allocator<T>().deallocate(ptr, n);
+		}
+
+		template<class U>
+		bool operator==(const counting_allocator<U>&) const noexcept { return true; }
+	};
+
+	using list_type = adt::compact_singly_list<int, counting_allocator<int>>;
+
+	using allocations = counting_allocator<char>;
+
+	// An element without a default constructor, which a list with a dummy element could not hold
+	struct no_default {
+		int value;
+
+		explicit no_default(int value) : value(value) {}
+
+		bool operator==(const no_default&) const = default;
+	};
+
+	// A 256-byte element, as kept in the buckets of a hash table
+	struct large {
+		char bytes[256] = {};
+	};
+
+} // namespace
+
+/* ---------------------------------Compact Singly List Constructors Tests----------------------------------- */
+TEST(compact_singly_list__constructors, default_constructor) {
+	allocations::allocations = 0;
+	list_type list;
+
+	EXPECT_TRUE(list.empty());
+	EXPECT_EQ(list.begin(), list.end());
+	EXPECT_EQ(allocations::allocations, 0);
+	EXPECT_THROW(static_cast<void>(list.front()), std::runtime_error);
+}
+
+TEST(compact_singly_list__constructors, object_size) {
+	// The sentinel and an empty allocator fit in a single pointer, whatever the size of the element
+	EXPECT_EQ(sizeof(adt::compact_singly_list<large>), sizeof(void*));
+	EXPECT_EQ(sizeof(list_type), sizeof(void*));
+}
+
+TEST(compact_singly_list__constructors, initializer_list_constructor) {
+	list_type list = {1, 2, 3};
+	std::vector<int> matcher = {1, 2, 3};
+
+	EXPECT_TRUE(std::equal(list.begin(), list.end(), matcher.begin(), matcher.end()));
+	EXPECT_EQ(list.front(), 1);
+}
+
+TEST(compact_singly_list__constructors, size_constructor) {
+	list_type list(3),
+			  filled(2, 7);
+
+	EXPECT_EQ(list, list_type({0, 0, 0}));
+	EXPECT_EQ(filled, list_type({7, 7}));
+}
+
+TEST(compact_singly_list__constructors, copy_constructor) {
+	list_type list = {1, 2, 3},
+			  list_copy(list);
+
+	EXPECT_EQ(list, list_copy);
+	EXPECT_NE(&list.front(), &list_copy.front());
+}
+
+TEST(compact_singly_list__constructors, move_constructor) {
+	list_type list = {1, 2, 3};
+	const int* front = &list.front();
+
+	allocations::allocations = 0;
+	list_type list_move(std::move(list));
+
+	EXPECT_EQ(allocations::allocations, 0);
+	EXPECT_EQ(&list_move.front(), front);
+	EXPECT_EQ(list_move, list_type({1, 2, 3}));
+	EXPECT_TRUE(list.empty());
+}
+
+TEST(compact_singly_list__constructors, no_default_constructor) {
+	adt::compact_singly_list<no_default> list;
+
+	list.emplace_front(2);
+	list.emplace_after(list.begin(), 3);
+	list.push_front(no_default(1));
+
+	EXPECT_EQ(list.front(), no_default(1));
+	EXPECT_EQ(std::distance(list.begin(), list.end()), 3);
+}
+
+/* ----------------------------------Compact Singly List Operators Tests------------------------------------- */
+TEST(compact_singly_list__operators, copy_assignment) {
+	list_type list = {1, 2, 3},
+			  other = {4, 5};
+
+	allocations::allocations = 0;
+	other = list;
+
+	// The existing nodes are reused, only the missing one is allocated
+	EXPECT_EQ(allocations::allocations, 1);
+	EXPECT_EQ(other, list);
+
+	allocations::deallocations = 0;
+	other = {6};
+	EXPECT_EQ(allocations::deallocations, 2);
+	EXPECT_EQ(other, list_type({6}));
+}
+
+TEST(compact_singly_list__operators, move_assignment) {
+	list_type list = {1, 2, 3},
+			  other = {4, 5};
+
+	other = std::move(list);
+
+	EXPECT_EQ(other, list_type({1, 2, 3}));
+	EXPECT_TRUE(list.empty());
+
+	// An empty allocator is always equal, so the nodes are always relinked
+	EXPECT_TRUE(std::is_nothrow_move_assignable_v<list_type>);
+}
+
+TEST(compact_singly_list__operators, comparison) {
+	list_type list = {1, 2, 3};
+
+	EXPECT_EQ(list, list_type({1, 2, 3}));
+	EXPECT_NE(list, list_type({1, 2}));
+	EXPECT_LT(list, list_type({1, 3}));
+	EXPECT_GT(list, list_type({1, 2}));
+}
+
+/* -----------------------------------Compact Singly List Methods Tests-------------------------------------- */
+TEST(compact_singly_list__methods, push_pop) {
+	list_type list;
+
+	list.push_front(2);
+	list.push_front(1);
+	EXPECT_EQ(list, list_type({1, 2}));
+
+	list.pop_front();
+	list.pop_front();
+	EXPECT_TRUE(list.empty());
+	EXPECT_THROW(list.pop_front(), std::runtime_error);
+}
+
+TEST(compact_singly_list__methods, insert_after) {
+	list_type list = {1, 5};
+
+	auto it = list.insert_after(list.begin(), 2);
+	EXPECT_EQ(*it, 2);
+
+	it = list.insert_after(it, {3, 4});
+	EXPECT_EQ(*it, 4);
+
+	list.insert_after(std::next(it, 1), 2, 6);
+	EXPECT_EQ(list, list_type({1, 2, 3, 4, 5, 6, 6}));
+
+	list_type other;
+	EXPECT_THROW(list.insert_after(other.before_begin(), 0), std::invalid_argument);
+	EXPECT_THROW(list.insert_after(list.end(), 0), std::runtime_error);
+}
+
+TEST(compact_singly_list__methods, erase_after) {
+	list_type list = {1, 2, 3, 4, 5};
+
+	allocations::deallocations = 0;
+	auto it = list.erase_after(list.begin());
+	EXPECT_EQ(*it, 3);
+
+	it = list.erase_after(list.begin(), std::next(list.begin(), 3));
+	EXPECT_EQ(allocations::deallocations, 3);
+	EXPECT_EQ(*it, 5);
+	EXPECT_EQ(list, list_type({1, 5}));
+
+	list.erase_after(list.begin());
+	EXPECT_THROW(list.erase_after(list.begin()), std::runtime_error);
+}
+
+TEST(compact_singly_list__methods, clear) {
+	list_type list = {1, 2, 3};
+
+	allocations::deallocations = 0;
+	list.clear();
+
+	EXPECT_TRUE(list.empty());
+	EXPECT_EQ(allocations::deallocations, 3);
+}
+
+TEST(compact_singly_list__methods, splice_after) {
+	list_type list = {1, 5},
+			  other = {2, 3, 4};
+	const int* two = &other.front();
+
+	list.splice_after(list.begin(), other);
+	EXPECT_EQ(list, list_type({1, 2, 3, 4, 5}));
+	EXPECT_TRUE(other.empty());
+	EXPECT_EQ(&*std::next(list.begin()), two);
+
+	// A single element, within the same list
+	list.splice_after(std::next(list.begin(), 4), list, list.before_begin());
+	EXPECT_EQ(list, list_type({2, 3, 4, 5, 1}));
+
+	// A range into another list
+	other.splice_after(other.before_begin(), list, list.begin(), std::next(list.begin(), 3));
+	EXPECT_EQ(other, list_type({3, 4}));
+	EXPECT_EQ(list, list_type({2, 5, 1}));
+
+	EXPECT_THROW(list.splice_after(list.begin(), list), std::invalid_argument);
+}
+
+TEST(compact_singly_list__methods, remove_if) {
+	list_type list = {1, 2, 3, 4, 5, 6};
+
+	EXPECT_EQ(list.remove_if([](int value) { return value % 2 == 0; }), 3);
+	EXPECT_EQ(list, list_type({1, 3, 5}));
+	EXPECT_EQ(list.remove(5), 1);
+	EXPECT_EQ(list, list_type({1, 3}));
+}
+
+TEST(compact_singly_list__methods, unique) {
+	list_type list = {1, 1, 2, 2, 2, 3, 1};
+
+	EXPECT_EQ(list.unique(), 3);
+	EXPECT_EQ(list, list_type({1, 2, 3, 1}));
+}
+
+TEST(compact_singly_list__methods, reverse) {
+	list_type list = {1, 2, 3};
+
+	list.reverse();
+	EXPECT_EQ(list, list_type({3, 2, 1}));
+}
+
+TEST(compact_singly_list__methods, sort) {
+	list_type list = {5, 3, 6, 1, 4, 2};
+
+	list.sort();
+	EXPECT_EQ(list, list_type({1, 2, 3, 4, 5, 6}));
+
+	// Stable: elements with the same parity keep their relative order
+	list.sort([](int lhs, int rhs) { return lhs % 2 < rhs % 2; });
+	EXPECT_EQ(list, list_type({2, 4, 6, 1, 3, 5}));
+}
+
+TEST(compact_singly_list__methods, merge) {
+	list_type list = {1, 3, 5},
+			  other = {2, 3, 6};
+
+	allocations::allocations = 0;
+	list.merge(other);
+
+	EXPECT_EQ(allocations::allocations, 0);
+	EXPECT_EQ(list, list_type({1, 2, 3, 3, 5, 6}));
+	EXPECT_TRUE(other.empty());
+}
+
+TEST(compact_singly_list__methods, swap) {
+	list_type list = {1, 2},
+			  other = {3};
+
+	swap(list, other);
+	EXPECT_EQ(list, list_type({3}));
+	EXPECT_EQ(other, list_type({1, 2}));
+}
+
+TEST(compact_singly_list__methods, destructor__frees_nodes) {
+	allocations::allocations = 0;
+	allocations::deallocations = 0;
+	{
+		list_type list = {1, 2, 3},
+				  other(list);
+		other.pop_front();
+		list = std::move(other);
+	}
+
+	EXPECT_EQ(allocations::allocations, allocations::deallocations);
+}
+
+TEST(compact_singly_list__methods, move_only_elements) {
+	adt::compact_singly_list<std::unique_ptr<std::string>> list;
+
+	list.push_front(std::make_unique<std::string>("b"));
+	list.emplace_front(std::make_unique<std::string>("a"));
+
+	adt::compact_singly_list<std::unique_ptr<std::string>> other(std::move(list));
+	EXPECT_EQ(*other.front(), "a");
+	EXPECT_TRUE(list.empty());
+}
@@ -0,0 +1,242 @@
+#ifndef CONCURRENT_SINGLY_LIST_HPP
+#define CONCURRENT_SINGLY_LIST_HPP
+
+#include <cstddef>
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "hazard_pointer.hpp"
+#include "singly_list.hpp"
+
+
+namespace adt {
+
+    // A singly linked list shared between threads, operated at the front only (i.e. a Treiber stack). push_front(),
+    // pop_front() and steal_all() are lock-free; popped nodes are reclaimed through hazard pointers, which also rules
+    // out ABA on the head. The nodes share singly_list's layout, so steal_all() hands the chain over as a singly_list.
+    // The allocator must be safe to call from several threads at once
+    template<class T, class Allocator = std::allocator<T>>
+    class concurrent_singly_list {
+    public:
+        /* -----------------------------------------------Definitions----------------------------------------------- */
+        using value_type = T;
+
+        using allocator_type = Allocator;
+
+        using size_type = std::size_t;
+
+        using reference = value_type&;
+
+        using const_reference = const value_type&;
+
+        using list_type = singly_list<T, Allocator>;
+
+    private:
+        /* -----------------------------------------------Definitions----------------------------------------------- */
+        using _Node = typename list_type::_Node;
+
+        using _NodeAllocator = typename list_type::_NodeAllocator;
+
+        using node_allocator_traits = typename std::allocator_traits<_NodeAllocator>;
+
+        // Keeps the contended head and the retired list on cache lines of their own
+        static constexpr std::size_t _cache_line = 64;
+
+        /* ------------------------------------------------Fields--------------------------------------------------- */
+        alignas(_cache_line) std::atomic<_Node*> head;
+
+        alignas(_cache_line) hazard_retired_list<_Node> retired;
+
+        allocator_type allocator;
+
+        _NodeAllocator node_allocator;
+
+        /* ------------------------------------------------Methods-------------------------------------------------- */
+        // A node's link may be read by a thread that still protects the node after it has been unlinked, so links of
+        // published nodes are only accessed atomically
+        [[nodiscard]] static _Node* _load_next(_Node* node) noexcept {
+            return std::atomic_ref<_Node*>(node->next).load(std::memory_order_acquire);
+        }
+
+        static void _store_next(_Node* node, _Node* next) noexcept {
+            std::atomic_ref<_Node*>(node->next).store(next, std::memory_order_relaxed);
+        }
+
+        template<class... Args>
+        _Node* _emplace_node(Args&&... args) {
+            _Node* node = node_allocator_traits::allocate(this->node_allocator, 1);
+            node_allocator_traits::construct(this->node_allocator, node, std::in_place, nullptr,
+                                             std::forward<Args>(args)...);
+            return node;
+        }
+
+        void _destroy_node(_Node* node) noexcept {
+            node_allocator_traits::destroy(this->node_allocator, node);
+            node_allocator_traits::deallocate(this->node_allocator, node, 1);
+        }
+
+        void _destroy_chain(_Node* node) noexcept {
+            while (node != nullptr) {
+                _Node* next = node->next;
+                this->_destroy_node(node);
+                node = next;
+            }
+        }
+
+        // Pushes the detached chain `first`..`last` on top of `top`
+        static void _push_chain(std::atomic<_Node*>& top, _Node* first, _Node* last) noexcept {
+            _Node* expected = top.load(std::memory_order_relaxed);
+
+            do {
+                _store_next(last, expected);
+            } while (!top.compare_exchange_weak(expected, first, std::memory_order_release, std::memory_order_relaxed));
+        }
+
+        // Pushes the detached chain starting at `first` back on top of the list
+        void _restore_chain(_Node* first) noexcept {
+            _Node* last = first;
+            while (_load_next(last) != nullptr) {
+                last = _load_next(last);
+            }
+
+            _push_chain(this->head, first, last);
+        }
+
+        // Defers freeing an unlinked node until no thread protects it
+        void _retire(_Node* node) {
+            if (this->retired.retire(node)) {
+                this->retired.reclaim([this](_Node* node) -> void { this->_destroy_node(node); });
+            }
+        }
+
+    public:
+        /* ----------------------------------------------Constructors----------------------------------------------- */
+        concurrent_singly_list() : concurrent_singly_list(allocator_type()) {}
+
+        explicit concurrent_singly_list(const allocator_type& allocator) noexcept
+            : head(nullptr), allocator(allocator), node_allocator(allocator) {}
+
+        concurrent_singly_list(const concurrent_singly_list&) = delete;
+
+        concurrent_singly_list(concurrent_singly_list&&) = delete;
+
+        /* -----------------------------------------------Destructor------------------------------------------------ */
+        // No other thread may access the list anymore
+        ~concurrent_singly_list() noexcept {
+            this->_destroy_chain(this->head.load(std::memory_order_acquire));
+            this->retired.clear([this](_Node* node) -> void { this->_destroy_node(node); });
+        }
+
+        /* ------------------------------------------Overloaded Operators------------------------------------------- */
+        concurrent_singly_list& operator=(const concurrent_singly_list&) = delete;
+
+        concurrent_singly_list& operator=(concurrent_singly_list&&) = delete;
+
+        /* ------------------------------------------------Methods-------------------------------------------------- */
+        [[nodiscard]] allocator_type get_allocator() const noexcept { return this->allocator; }
+
+        // A snapshot: other threads may push or pop right after it is taken
+        [[nodiscard]] bool empty() const noexcept { return this->head.load(std::memory_order_acquire) == nullptr; }
+
+        void push_front(const_reference value) { this->emplace_front(value); }
+
+        void push_front(value_type&& value) { this->emplace_front(std::move(value)); }
+
+        template<class... Args>
+        void emplace_front(Args&&... args) {
+            _Node* node = this->_emplace_node(std::forward<Args>(args)...);
+            _push_chain(this->head, node, node);
+        }
+
+        // Removes the front element and returns it, or returns nothing if the list is empty
+        std::optional<value_type> pop_front() {
+            _Node* node;
+
+            while (true) {
+                node = hazard_pointers::protect(0, this->head);
+                if (node == nullptr) {
+                    hazard_pointers::clear(0);
+                    return std::nullopt;
+                }
+
+                // `node` cannot be freed (nor reused) while protected, so if it is still the head its link is current
+                _Node* expected = node;
+                if (this->head.compare_exchange_weak(expected, _load_next(node))) {
+                    break;
+                }
+            }
+
+            hazard_pointers::clear(0);
+
+            // Only the thread that unlinked the node touches its value
+            std::optional<value_type> value(std::move(node->value));
+            this->_retire(node);
+
+            return value;
+        }
+
+        // Atomically takes every element, in front-to-back order, leaving the list empty
+        list_type steal_all() {
+            list_type list(this->allocator);
+
+            _Node* node = this->head.exchange(nullptr);
+            if (node == nullptr) {
+                return list;
+            }
+
+            _Node* first = nullptr,
+                 * last = nullptr;
+            size_type count = 0;
+
+            try {
+                // Nodes are now unreachable from the head, so only threads that already protect one may still read it.
+                // The snapshot must follow the exchange, or a thread protecting the head in between would be missed
+                const std::vector<const void*> hazards = hazard_pointers::snapshot();
+
+                while (node != nullptr) {
+                    _Node* next = _load_next(node);
+
+                    // Hand a protected node over as a copy of itself and retire the original
+                    if (hazard_pointers::is_protected(hazards, node)) {
+                        _Node* copy = this->_emplace_node(std::move(node->value));
+                        this->_retire(node);
+                        node = copy;
+                    }
+
+                    if (last == nullptr) {
+                        first = node;
+                    } else {
+                        _store_next(last, node);
+                    }
+                    last = node;
+                    count++;
+
+                    node = next;
+                }
+            } catch (...) {
+                // Give back the nodes gathered so far, followed by those not reached yet, so that no element is lost
+                if (last != nullptr) {
+                    _store_next(last, node);
+                    node = first;
+                }
+                if (node != nullptr) {
+                    this->_restore_chain(node);
+                }
+                throw;
+            }
+
+            last->next = nullptr;
+            list._adopt_chain(first, last, count);
+
+            return list;
+        }
+
+    };
+
+} // adt
+
+
+#endif // CONCURRENT_SINGLY_LIST_HPP
@@ -0,0 +1,79 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <mutex>
+#include <optional>
+
+#include "concurrent_singly_list.hpp"
+#include "singly_list.hpp"
+
+
+/* -------------------------------------------Definitions---------------------------------------------------- */
+using value_type = int;
+
+// Baseline: a singly_list shared behind a mutex
+class locked_singly_list {
+private:
+	std::mutex mutex;
+
+	adt::singly_list<value_type> list;
+
+public:
+	void push_front(value_type value) {
+		std::lock_guard<std::mutex> lock(this->mutex);
+		this->list.push_front(value);
+	}
+
+	std::optional<value_type> pop_front() {
+		std::lock_guard<std::mutex> lock(this->mutex);
+		if (this->list.empty()) {
+			return std::nullopt;
+		}
+
+		value_type value = this->list.front();
+		this->list.pop_front();
+		return value;
+	}
+};
+
+/* ------------------------------------------Push/Pop Benchmarks--------------------------------------------- */
+// Every thread pushes a batch of elements onto a shared list, then pops as many
+template<class Container>
+static void bench_push_pop(benchmark::State& state) {
+	static Container container;
+	constexpr int batch = 64;
+
+	for (auto _ : state) {
+		for (int i = 0; i < batch; i++) {
+			container.push_front(i);
+		}
+		for (int i = 0; i < batch; i++) {
+			benchmark::DoNotOptimize(container.pop_front());
+		}
+	}
+
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * batch * 2);
+}
+BENCHMARK(bench_push_pop<adt::concurrent_singly_list<value_type>>)->Name("push_pop<adt::concurrent_singly_list>")
+	->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK(bench_push_pop<locked_singly_list>)->Name("push_pop<mutex + adt::singly_list>")
+	->ThreadRange(1, 64)->UseRealTime();
+
+/* --------------------------------------------Drain Benchmarks---------------------------------------------- */
+// Thread 0 drains the list in one go while the other threads keep pushing
+template<class Container>
+static void bench_push_steal_all(benchmark::State& state) {
+	static Container container;
+
+	for (auto _ : state) {
+		if (state.thread_index() == 0) {
+			benchmark::DoNotOptimize(container.steal_all());
+		} else {
+			container.push_front(0);
+		}
+	}
+
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+}
+BENCHMARK(bench_push_steal_all<adt::concurrent_singly_list<value_type>>)
+	->Name("push_steal_all<adt::concurrent_singly_list>")->ThreadRange(2, 64)->UseRealTime();
@@ -0,0 +1,230 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <memory> // to test move-only elements
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+
+#include "concurrent_singly_list.hpp"
+
+
+/* -------------------------------------------Definitions---------------------------------------------------- */
+using list_type = adt::concurrent_singly_list<int>;
+
+namespace {
+
+	// Counts the instances alive, to check that every element is destroyed
+	struct tracked {
+		static inline int alive = 0;
+
+		tracked() { alive++; }
+
+		tracked(const tracked&) { alive++; }
+
+		~tracked() { alive--; }
+	};
+
+	// Remembers the last block any of its copies allocated, and throws std::bad_alloc instead while `fail` is set
+	template<class T>
+	struct failing_allocator {
+		using value_type = T;
+
+		static inline void* last = nullptr;
+
+		static inline bool fail = false;
+
+		failing_allocator() = default;
+
+		template<class U>
+		failing_allocator(const failing_allocator<U>&) noexcept {}
+
+		T* allocate(std::size_t n) {
+			if (failing_allocator<char>::fail) {
+				throw std::bad_alloc();
+			}
+
+			T* ptr = std::allocator<T>().allocate(n);
+			failing_allocator<char>::last = ptr;
+			return ptr;
+		}
+
+		void deallocate(T* ptr, std::size_t n) noexcept { std::allocator<T>().deallocate(ptr, n); }
+
+		template<class U>
+		bool operator==(const failing_allocator<U>&) const noexcept { return true; }
+	};
+
+} // namespace
+
+/* -------------------------------Concurrent Singly List Single-Threaded Tests------------------------------- */
+TEST(concurrent_singly_list__methods, default_constructor) {
+	list_type list;
+
+	EXPECT_TRUE(list.empty());
+	EXPECT_EQ(list.pop_front(), std::nullopt);
+	EXPECT_TRUE(list.steal_all().empty());
+}
+
+TEST(concurrent_singly_list__methods, push_front__pop_front) {
+	list_type list;
+
+	for (int i = 0; i < 200; i++) {
+		list.push_front(i);
+	}
+	EXPECT_FALSE(list.empty());
+
+	// Enough pops to go through several reclamation passes
+	for (int i = 199; i >= 0; i--) {
+		EXPECT_EQ(list.pop_front(), i);
+	}
+
+	EXPECT_TRUE(list.empty());
+	EXPECT_EQ(list.pop_front(), std::nullopt);
+}
+
+TEST(concurrent_singly_list__methods, emplace_front__move_only) {
+	adt::concurrent_singly_list<std::unique_ptr<int>> list;
+
+	list.emplace_front(std::make_unique<int>(1));
+	list.push_front(std::make_unique<int>(2));
+
+	std::optional<std::unique_ptr<int>> value = list.pop_front();
+	ASSERT_TRUE(value.has_value());
+	EXPECT_EQ(**value, 2);
+}
+
+TEST(concurrent_singly_list__methods, steal_all) {
+	list_type list;
+	std::vector<int> matcher = {4, 3, 2, 1, 0};
+
+	for (int i = 0; i < 5; i++) {
+		list.push_front(i);
+	}
+
+	adt::singly_list<int> stolen = list.steal_all();
+
+	EXPECT_TRUE(list.empty());
+	EXPECT_EQ(stolen.size(), 5);
+	EXPECT_EQ(stolen.back(), 0);
+	EXPECT_TRUE(std::equal(stolen.begin(), stolen.end(), matcher.begin(), matcher.end()));
+
+	// The stolen chain behaves like any other singly_list
+	stolen.push_back(-1);
+	stolen.push_front(5);
+	EXPECT_EQ(stolen.size(), 7);
+	EXPECT_EQ(stolen.back(), -1);
+	EXPECT_EQ(stolen.front(), 5);
+}
+
+TEST(concurrent_singly_list__methods, destructor__releases_elements) {
+	{
+		adt::concurrent_singly_list<tracked> list;
+		for (int i = 0; i < 10; i++) {
+			list.emplace_front();
+		}
+		static_cast<void>(list.pop_front());
+	}
+
+	EXPECT_EQ(tracked::alive, 0);
+}
+
+/* -------------------------------Concurrent Singly List Multi-Threaded Tests-------------------------------- */
+TEST(concurrent_singly_list__methods, steal_all__allocation_failure) {
+	adt::concurrent_singly_list<int, failing_allocator<int>> list;
+	std::vector<int> matcher = {3, 2, 1};
+
+	// Protecting the node of 2 makes steal_all() copy it, and the copy fails
+	list.push_front(1);
+	list.push_front(2);
+	adt::hazard_pointers::set(0, failing_allocator<char>::last);
+	list.push_front(3);
+
+	failing_allocator<char>::fail = true;
+	EXPECT_THROW(static_cast<void>(list.steal_all()), std::bad_alloc);
+	failing_allocator<char>::fail = false;
+	adt::hazard_pointers::clear(0);
+
+	// Every element was handed back, in order
+	adt::singly_list<int, failing_allocator<int>> stolen = list.steal_all();
+	EXPECT_TRUE(std::equal(stolen.begin(), stolen.end(), matcher.begin(), matcher.end()));
+}
+
+TEST(concurrent_singly_list__threads, push_front__pop_front) {
+	constexpr int thread_count = 4,
+				  per_thread = 20'000;
+	list_type list;
+	std::atomic<long long> popped_sum = 0;
+	std::atomic<int> popped_count = 0;
+	std::vector<std::thread> threads;
+
+	for (int t = 0; t < thread_count; t++) {
+		threads.emplace_back([&, t]() {
+			for (int i = 0; i < per_thread; i++) {
+				list.push_front(t * per_thread + i);
+
+				if (std::optional<int> value = list.pop_front()) {
+					popped_sum += *value;
+					popped_count++;
+				}
+			}
+		});
+	}
+	for (std::thread& thread : threads) {
+		thread.join();
+	}
+
+	while (std::optional<int> value = list.pop_front()) {
+		popped_sum += *value;
+		popped_count++;
+	}
+
+	constexpr long long total = static_cast<long long>(thread_count) * per_thread;
+	EXPECT_EQ(popped_count, total);
+	EXPECT_EQ(popped_sum, total * (total - 1) / 2);
+}
+
+TEST(concurrent_singly_list__threads, steal_all__concurrent_pops) {
+	constexpr int thread_count = 4,
+				  per_thread = 20'000;
+	list_type list;
+	std::atomic<long long> sum = 0;
+	std::atomic<int> count = 0,
+					 producers_done = 0;
+	std::vector<std::thread> threads;
+
+	for (int t = 0; t < thread_count; t++) {
+		threads.emplace_back([&, t]() {
+			for (int i = 0; i < per_thread; i++) {
+				list.push_front(t * per_thread + i);
+			}
+			producers_done++;
+		});
+	}
+
+	// One thread pops while another steals, both racing with the producers
+	threads.emplace_back([&]() {
+		while (producers_done < thread_count || !list.empty()) {
+			if (std::optional<int> value = list.pop_front()) {
+				sum += *value;
+				count++;
+			}
+		}
+	});
+	threads.emplace_back([&]() {
+		while (producers_done < thread_count || !list.empty()) {
+			for (int value : list.steal_all()) {
+				sum += value;
+				count++;
+			}
+		}
+	});
+	for (std::thread& thread : threads) {
+		thread.join();
+	}
+
+	constexpr long long total = static_cast<long long>(thread_count) * per_thread;
+	EXPECT_EQ(count, total);
+	EXPECT_EQ(sum, total * (total - 1) / 2);
+}
@@ -0,0 +1,252 @@
+#ifndef HAZARD_POINTER_HPP
+#define HAZARD_POINTER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+
+namespace adt {
+
+    // Process-wide registry of hazard pointers. Each thread owns `slots_per_thread` slots in which it publishes the
+    // nodes it is about to dereference; a lock-free container only frees a node it has unlinked once no slot holds it
+    class hazard_pointers {
+    public:
+        /* ----------------------------------------------Definitions------------------------------------------------ */
+        static constexpr std::size_t slots_per_thread = 2;
+
+    private:
+        /* -----------------------------------------------Record---------------------------------------------------- */
+        struct _Record {
+            /* --------------------------------------------Fields--------------------------------------------------- */
+            std::atomic<const void*> slots[slots_per_thread] = {};
+
+            std::atomic<bool> active = true;
+
+            _Record* next = nullptr;
+
+        };
+
+        /* ------------------------------------------------Owner---------------------------------------------------- */
+        // Holds the calling thread's record for as long as the thread lives
+        struct _Owner {
+            /* --------------------------------------------Fields--------------------------------------------------- */
+            _Record* record;
+
+            /* -----------------------------------------Constructors------------------------------------------------ */
+            _Owner() : record(hazard_pointers::_acquire()) {}
+
+            /* ------------------------------------------Destructor------------------------------------------------- */
+            ~_Owner() noexcept {
+                for (std::atomic<const void*>& slot : this->record->slots) {
+                    slot.store(nullptr, std::memory_order_relaxed);
+                }
+                this->record->active.store(false, std::memory_order_release);
+            }
+
+        };
+
+        /* ------------------------------------------------Methods-------------------------------------------------- */
+        static std::atomic<_Record*>& _records() noexcept {
+            // Records are intentionally never destroyed: an exiting thread gives its record back for reuse instead
+            static std::atomic<_Record*> records(nullptr);
+            return records;
+        }
+
+        static _Record* _acquire() {
+            std::atomic<_Record*>& records = _records();
+
+            // Reuse the record of a thread that has exited
+            for (_Record* record = records.load(std::memory_order_acquire); record != nullptr; record = record->next) {
+                if (!record->active.load(std::memory_order_relaxed)
+                    && !record->active.exchange(true, std::memory_order_acquire)) {
+                    return record;
+                }
+            }
+
+            _Record* record = new _Record();
+            record->next = records.load(std::memory_order_relaxed);
+            while (!records.compare_exchange_weak(record->next, record, std::memory_order_release,
+                                                  std::memory_order_relaxed)) {}
+
+            return record;
+        }
+
+        static _Record& _record() {
+            thread_local _Owner owner;
+            return *owner.record;
+        }
+
+    public:
+        /* ------------------------------------------------Methods-------------------------------------------------- */
+        // Publishes the pointer currently held by `source` (e.g. an std::atomic or std::atomic_ref of a pointer) in the
+        // calling thread's slot `slot`, and returns it once `source` is confirmed to still hold it. The pointee
+        // cannot be reclaimed until the slot is cleared
+        template<class Source>
+        static auto protect(std::size_t slot, const Source& source) {
+            std::atomic<const void*>& hazard = _record().slots[slot];
+            auto ptr = source.load();
+
+            while (true) {
+                hazard.store(ptr);
+
+                auto current = source.load();
+                if (current == ptr) {
+                    return ptr;
+                }
+                ptr = current;
+            }
+        }
+
+        // Publishes `ptr` in the calling thread's slot `slot`. Unlike protect(), the caller has to confirm on its own
+        // that `ptr` was still reachable once published
+        static void set(std::size_t slot, const void* ptr) { _record().slots[slot].store(ptr); }
+
+        static void clear(std::size_t slot) { _record().slots[slot].store(nullptr, std::memory_order_release); }
+
+        // Returns every pointer currently protected by any thread, sorted so that it can be binary searched
+        [[nodiscard]] static std::vector<const void*> snapshot() {
+            std::vector<const void*> hazards;
+
+            for (_Record* record = _records().load(std::memory_order_acquire); record != nullptr; record = record->next) {
+                for (const std::atomic<const void*>& slot : record->slots) {
+                    const void* ptr = slot.load();
+                    if (ptr != nullptr) {
+                        hazards.push_back(ptr);
+                    }
+                }
+            }
+
+            std::sort(hazards.begin(), hazards.end(), std::less<const void*>());
+            return hazards;
+        }
+
+        // Whether `ptr` is in a sorted snapshot()
+        [[nodiscard]] static bool is_protected(const std::vector<const void*>& hazards, const void* ptr) noexcept {
+            return std::binary_search(hazards.begin(), hazards.end(), ptr, std::less<const void*>());
+        }
+
+    };
+
+    // Lock-free stack of the nodes a lock-free container has unlinked, each freed once no hazard pointer protects it.
+    // Nodes are linked through their `next` member. The links are tagged so that they are never null: a thread that
+    // still protects a retired node can then never mistake it for the last node of the container
+    template<class Node>
+    class hazard_retired_list {
+    private:
+        /* ----------------------------------------------Definitions------------------------------------------------ */
+        // Number of retired nodes past which a reclamation pass is worth its snapshot of the hazard pointers
+        static constexpr std::size_t _reclaim_threshold = 64;
+
+        /* ------------------------------------------------Fields--------------------------------------------------- */
+        std::atomic<Node*> top;
+
+        std::atomic<std::size_t> count;
+
+        /* ------------------------------------------------Methods-------------------------------------------------- */
+        [[nodiscard]] static Node* _tag(Node* node) noexcept {
+            return reinterpret_cast<Node*>(reinterpret_cast<std::uintptr_t>(node) | 1);
+        }
+
+        [[nodiscard]] static Node* _untag(Node* node) noexcept {
+            return reinterpret_cast<Node*>(reinterpret_cast<std::uintptr_t>(node) & ~std::uintptr_t(1));
+        }
+
+        void _push_chain(Node* first, Node* last) noexcept {
+            Node* expected = this->top.load(std::memory_order_relaxed);
+
+            do {
+                std::atomic_ref<Node*>(last->next).store(_tag(expected), std::memory_order_relaxed);
+            } while (!this->top.compare_exchange_weak(expected, first, std::memory_order_release,
+                                                      std::memory_order_relaxed));
+        }
+
+    public:
+        /* ----------------------------------------------Constructors----------------------------------------------- */
+        constexpr hazard_retired_list() noexcept : top(nullptr), count(0) {}
+
+        hazard_retired_list(const hazard_retired_list&) = delete;
+
+        hazard_retired_list(hazard_retired_list&&) = delete;
+
+        /* ------------------------------------------Overloaded Operators------------------------------------------- */
+        hazard_retired_list& operator=(const hazard_retired_list&) = delete;
+
+        hazard_retired_list& operator=(hazard_retired_list&&) = delete;
+
+        /* ------------------------------------------------Methods-------------------------------------------------- */
+        // Retires a node no longer reachable from the container. Returns whether reclaim() should now be called
+        [[nodiscard]] bool retire(Node* node) noexcept {
+            this->_push_chain(node, node);
+            return this->count.fetch_add(1, std::memory_order_relaxed) + 1 >= _reclaim_threshold;
+        }
+
+        // Calls `free_node` on every retired node that no thread protects, and retires the others again
+        template<class Free>
+        void reclaim(Free free_node) {
+            Node* node = _untag(this->top.exchange(nullptr));
+            if (node == nullptr) {
+                return;
+            }
+
+            std::vector<const void*> hazards;
+            try {
+                hazards = hazard_pointers::snapshot();
+            } catch (...) {
+                // Retire the whole chain again rather than lose it
+                Node* last = node;
+                while (_untag(std::atomic_ref<Node*>(last->next).load(std::memory_order_acquire)) != nullptr) {
+                    last = _untag(std::atomic_ref<Node*>(last->next).load(std::memory_order_acquire));
+                }
+                this->_push_chain(node, last);
+                throw;
+            }
+
+            Node* kept_first = nullptr,
+                * kept_last = nullptr;
+            std::size_t freed = 0;
+
+            while (node != nullptr) {
+                Node* next = _untag(std::atomic_ref<Node*>(node->next).load(std::memory_order_acquire));
+
+                if (hazard_pointers::is_protected(hazards, node)) {
+                    std::atomic_ref<Node*>(node->next).store(_tag(kept_first), std::memory_order_relaxed);
+                    kept_first = node;
+                    kept_last = (kept_last == nullptr) ? node : kept_last;
+                } else {
+                    free_node(node);
+                    freed++;
+                }
+
+                node = next;
+            }
+
+            this->count.fetch_sub(freed, std::memory_order_relaxed);
+            if (kept_first != nullptr) {
+                this->_push_chain(kept_first, kept_last);
+            }
+        }
+
+        // Calls `free_node` on every retired node. No other thread may access the container anymore
+        template<class Free>
+        void clear(Free free_node) noexcept {
+            Node* node = _untag(this->top.exchange(nullptr));
+
+            while (node != nullptr) {
+                Node* next = _untag(node->next);
+                free_node(node);
+                node = next;
+            }
+
+            this->count.store(0, std::memory_order_relaxed);
+        }
+
+    };
+
+} // adt
+
+
+#endif // HAZARD_POINTER_HPP
@@ -0,0 +1,919 @@
+#ifndef INDEX_SINGLY_LIST_HPP
+#define INDEX_SINGLY_LIST_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <initializer_list>
+#include <stdexcept>
+#include <string>
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <compare>
+#include <concepts>
+#include <limits>
+#include <utility>
+
+
+namespace adt {
+
+    // A singly linked list whose nodes live in one contiguous arena owned by the list, linked by `Index`-sized
+    // positions into that arena instead of pointers. With the default 32-bit index, a node of an int is 8 bytes instead
+    // of the 16 of an adt::singly_list node, and a 16-bit index shrinks nodes of small elements further for lists of at
+    // most 65534 elements. Erased nodes are reused by later insertions, and the arena grows geometrically like a
+    // std::vector. Growing moves the elements, so it invalidates pointers and references to them, but not iterators,
+    // which hold positions in the arena
+    template<class T, std::unsigned_integral Index = std::uint32_t, class Allocator = std::allocator<T>>
+    class index_singly_list {
+    public:
+        /* -----------------------------------------------Definitions----------------------------------------------- */
+        using value_type = T;
+
+        using index_type = Index;
+
+        using allocator_type = Allocator;
+
+        using size_type = std::size_t;
+
+        using difference_type = std::ptrdiff_t;
+
+        using reference = value_type&;
+
+        using const_reference = const value_type&;
+
+        using pointer = typename std::allocator_traits<allocator_type>::pointer;
+
+        using const_pointer = typename std::allocator_traits<allocator_type>::const_pointer;
+
+    private:
+        /* -------------------------------------------------Node---------------------------------------------------- */
+        // The value is only alive while the node is linked in the list; free nodes only hold the index of the next
+        // free node
+        struct _Node {
+            /* --------------------------------------------Fields--------------------------------------------------- */
+            union {
+                value_type value;
+            };
+
+            index_type next;
+
+            /* -----------------------------------------Constructors------------------------------------------------ */
+            constexpr _Node() noexcept : next(0) {}
+
+            /* -------------------------------------------Destructor------------------------------------------------ */
+            constexpr ~_Node() noexcept {}
+
+        };
+
+        /* ----------------------------------------------Definitions------------------------------------------------ */
+        using allocator_traits = typename std::allocator_traits<allocator_type>;
+
+        using _NodeAllocator = typename allocator_traits::template rebind_alloc<_Node>;
+
+        using node_allocator_traits = typename std::allocator_traits<_NodeAllocator>;
+
+        // The index that ends the list (the end() position)
+        static constexpr index_type _null = std::numeric_limits<index_type>::max();
+
+        // The index of the position before the first element, whose `next` is the `first` field
+        static constexpr index_type _before_begin = _null - 1;
+
+        /* ------------------------------------------------Fields--------------------------------------------------- */
+        _Node* nodes;
+
+        _NodeAllocator node_allocator;
+
+        // Number of nodes in the arena
+        index_type cap;
+
+        // Nodes [0, `used`) have been handed out at least once; those past it have never been
+        index_type used;
+
+        // Erased nodes, linked through their `next`
+        index_type free_nodes;
+
+        index_type first;
+
+        // `_before_begin` while the list is empty
+        index_type last;
+
+        index_type sz;
+
+        /* ------------------------------------------------Methods-------------------------------------------------- */
+        [[nodiscard]] constexpr index_type& _next(index_type index) noexcept {
+            return (index == _before_begin) ? this->first : this->nodes[index].next;
+        }
+
+        [[nodiscard]] constexpr index_type _next(index_type index) const noexcept {
+            return (index == _before_begin) ? this->first : this->nodes[index].next;
+        }
+
+        [[nodiscard]] constexpr reference _value(index_type index) const noexcept { return this->nodes[index].value; }
+
+        [[nodiscard]] constexpr _Node* _allocate_arena(size_type capacity) {
+            _Node* arena = node_allocator_traits::allocate(this->node_allocator, capacity);
+
+            for (size_type i = 0; i < capacity; i++) {
+                std::construct_at(arena + i);
+            }
+
+            return arena;
+        }
+
+        constexpr void _deallocate_arena(_Node* arena, size_type capacity) noexcept {
+            if (arena != nullptr) {
+                std::destroy_n(arena, capacity);
+                node_allocator_traits::deallocate(this->node_allocator, arena, capacity);
+            }
+        }
+
+        // Moves every element into `arena` at the same index and replaces the current arena with it. Elements that
+        // cannot be moved without throwing are copied; if a copy throws, the copies made so far are destroyed and the
+        // list is left unchanged, but freeing `arena` is up to the caller
+        constexpr void _relocate(_Node* arena, size_type capacity) {
+            index_type i = this->first;
+
+            try {
+                for (; i != _null; i = this->nodes[i].next) {
+                    std::construct_at(std::addressof(arena[i].value), std::move_if_noexcept(this->nodes[i].value));
+                }
+            } catch (...) {
+                for (index_type j = this->first; j != i; j = this->nodes[j].next) {
+                    std::destroy_at(std::addressof(arena[j].value));
+                }
+                throw;
+            }
+
+            for (i = this->first; i != _null; i = this->nodes[i].next) {
+                std::destroy_at(std::addressof(this->nodes[i].value));
+            }
+
+            for (i = 0; i < this->used; i++) {
+                arena[i].next = this->nodes[i].next;
+            }
+
+            this->_deallocate_arena(this->nodes, this->cap);
+            this->nodes = arena;
+            this->cap = static_cast<index_type>(capacity);
+        }
+
+        // The capacity to grow to when the arena is full: double the current one, within max_size()
+        [[nodiscard]] constexpr size_type _next_capacity() const {
+            if (this->cap == this->max_size()) {
+                throw std::length_error("adt::index_singly_list cannot hold more than max_size() elements");
+            }
+
+            return std::min<size_type>(std::max<size_type>(2 * static_cast<size_type>(this->cap), 8), this->max_size());
+        }
+
+        // Constructs a value from `args` in a free node and returns its index. The node is not linked yet. When the
+        // arena is full, the value is constructed in the new arena before the elements are moved, so `args` may refer
+        // to elements of the list
+        template<class... Args>
+        constexpr index_type _emplace_node(Args&&... args) {
+            index_type index;
+
+            if (this->free_nodes != _null) {
+                index = this->free_nodes;
+                this->free_nodes = this->nodes[index].next;
+            } else if (this->used < this->cap) {
+                index = this->used++;
+            } else {
+                const size_type capacity = this->_next_capacity();
+                _Node* arena = this->_allocate_arena(capacity);
+
+                index = this->used;
+                try {
+                    std::construct_at(std::addressof(arena[index].value), std::forward<Args>(args)...);
+                } catch (...) {
+                    this->_deallocate_arena(arena, capacity);
+                    throw;
+                }
+
+                try {
+                    this->_relocate(arena, capacity);
+                } catch (...) {
+                    std::destroy_at(std::addressof(arena[index].value));
+                    this->_deallocate_arena(arena, capacity);
+                    throw;
+                }
+                this->used++;
+
+                return index;
+            }
+
+            std::construct_at(std::addressof(this->nodes[index].value), std::forward<Args>(args)...);
+            return index;
+        }
+
+        constexpr void _delete_node(index_type index) noexcept {
+            std::destroy_at(std::addressof(this->nodes[index].value));
+            this->nodes[index].next = this->free_nodes;
+            this->free_nodes = index;
+        }
+
+        template<class... Args>
+        constexpr index_type _insert_after(index_type pos, Args&&... args) {
+            const index_type index = this->_emplace_node(std::forward<Args>(args)...);
+
+            // The arena may have moved, so `pos` is only looked up now
+            this->nodes[index].next = this->_next(pos);
+            this->_next(pos) = index;
+
+            if (pos == this->last) {
+                this->last = index;
+            }
+            this->sz++;
+
+            return index;
+        }
+
+        constexpr index_type _erase_after(index_type pos) noexcept {
+            const index_type index = this->_next(pos);
+
+            this->_next(pos) = this->nodes[index].next;
+            if (index == this->last) {
+                this->last = pos;
+            }
+
+            this->_delete_node(index);
+            this->sz--;
+
+            return this->_next(pos);
+        }
+
+        // Destroys every element and forgets every node, keeping the arena
+        constexpr void _clear() noexcept {
+            for (index_type i = this->first; i != _null; i = this->nodes[i].next) {
+                std::destroy_at(std::addressof(this->nodes[i].value));
+            }
+
+            this->used = 0;
+            this->free_nodes = _null;
+            this->first = _null;
+            this->last = _before_begin;
+            this->sz = 0;
+        }
+
+        [[nodiscard]] constexpr bool _is_allocator_equal(const index_singly_list& other) const noexcept {
+            if constexpr (allocator_traits::is_always_equal::value) {
+                return true;
+            } else {
+                return this->node_allocator == other.node_allocator;
+            }
+        }
+
+        // Moves every element of `other` into the arena of `*this`, which must be empty, then destroys them in `other`
+        constexpr void _move_elements(index_singly_list& other) {
+            this->reserve(other.sz);
+
+            for (index_type i = other.first; i != _null; i = other.nodes[i].next) {
+                this->_insert_after(this->last, std::move(other.nodes[i].value));
+            }
+            other._clear();
+        }
+
+        // Whether the elements occupy nodes 0, 1, 2... in traversal order
+        [[nodiscard]] constexpr bool _is_sequential() const noexcept {
+            index_type expected = 0;
+
+            for (index_type i = this->first; i != _null; i = this->nodes[i].next) {
+                if (i != expected++) {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        constexpr void _steal(index_singly_list& other) noexcept {
+            this->nodes = std::exchange(other.nodes, nullptr);
+            this->cap = std::exchange(other.cap, 0);
+            this->used = std::exchange(other.used, 0);
+            this->free_nodes = std::exchange(other.free_nodes, _null);
+            this->first = std::exchange(other.first, _null);
+            this->last = std::exchange(other.last, _before_begin);
+            this->sz = std::exchange(other.sz, 0);
+        }
+
+        template<class Compare>
+        constexpr index_type _merge_sort_merge(index_type first_half, index_type second_half,
+                                               Compare& comp) noexcept {
+            index_type merged = _null;
+            index_type* link = &merged;
+
+            // While both halves have elements left to merge...
+            while (first_half != _null && second_half != _null) {
+                // Take from `second_half` only if it strictly precedes `first_half` to keep the merge stable
+                if (comp(this->_value(second_half), this->_value(first_half))) {
+                    *link = second_half;
+                    second_half = this->nodes[second_half].next;
+                } else {
+                    *link = first_half;
+                    first_half = this->nodes[first_half].next;
+                }
+
+                // Advance to the link of the element just merged
+                link = &(this->nodes[*link].next);
+            }
+
+            // Append whatever remains of the half that was not exhausted
+            *link = (first_half != _null) ? first_half : second_half;
+
+            return merged;
+        }
+
+        // Bottom-up merge sort, as in adt::singly_list
+        template<class Compare>
+        constexpr index_type _merge_sort(index_type index, Compare& comp) noexcept {
+            // `runs[i]` holds either `_null` or a sorted run of exactly 2^i elements. Runs in higher slots always hold
+            // elements that appeared earlier in the list, which keeps the sort stable
+            index_type runs[std::numeric_limits<index_type>::digits];
+            index_type carry;
+            size_type i;
+
+            std::fill(std::begin(runs), std::end(runs), _null);
+
+            while (index != _null) {
+                // Detach the next element as a sorted run of length 1
+                carry = index;
+                index = this->nodes[index].next;
+                this->nodes[carry].next = _null;
+
+                // Merge `carry` with every occupied slot, like propagating a carry in binary addition
+                for (i = 0; runs[i] != _null; i++) {
+                    carry = this->_merge_sort_merge(runs[i], carry, comp);
+                    runs[i] = _null;
+                }
+                runs[i] = carry;
+            }
+
+            // Merge the remaining runs from the latest (lowest slot) to the earliest (highest slot)
+            carry = _null;
+            for (i = 0; i < std::numeric_limits<index_type>::digits; i++) {
+                if (runs[i] != _null) {
+                    carry = this->_merge_sort_merge(runs[i], carry, comp);
+                }
+            }
+
+            return carry;
+        }
+
+    public:
+        /* -----------------------------------------------Iterators------------------------------------------------- */
+        class iterator;
+
+        class const_iterator {
+        private:
+            /* ---------------------------------------------Fields-------------------------------------------------- */
+            const index_singly_list* parent;
+
+            index_type node;
+
+            /* -------------------------------------------Constructors---------------------------------------------- */
+            constexpr const_iterator(const index_singly_list* parent, index_type node) noexcept
+                : parent(parent), node(node) {}
+
+            /* ---------------------------------------------Methods------------------------------------------------- */
+            [[nodiscard]] constexpr bool _is_dereferenceable() const noexcept {
+                return this->node != _null && this->node != _before_begin;
+            }
+
+            /* ---------------------------------------------Friends------------------------------------------------- */
+            friend class index_singly_list;
+
+            friend class iterator;
+
+        public:
+            /* -------------------------------------------Definitions----------------------------------------------- */
+            using iterator_category = std::forward_iterator_tag;
+
+            using value_type = typename index_singly_list::value_type;
+
+            using difference_type = typename index_singly_list::difference_type;
+
+            using reference = const value_type&;
+
+            using pointer = const value_type*;
+
+            /* ------------------------------------------Constructors----------------------------------------------- */
+            constexpr const_iterator() noexcept : parent(nullptr), node(_null) {}
+
+            /* ---------------------------------------Overloaded Operators------------------------------------------ */
+            [[nodiscard]] constexpr reference operator*() const {
+                if (!this->_is_dereferenceable()) {
+                    throw std::runtime_error("segmentation fault");
+                }
+                return this->parent->_value(this->node);
+            }
+
+            [[nodiscard]] constexpr pointer operator->() const { return &(**this); }
+
+            constexpr const_iterator& operator++() {
+                if (this->node == _null) {
+                    throw std::runtime_error("segmentation fault");
+                }
+                this->node = this->parent->_next(this->node);
+                return *this;
+            }
+
+            constexpr const_iterator operator++(int) {
+                const_iterator temp = *this;
+                ++(*this);
+                return temp;
+            }
+
+            [[nodiscard]] constexpr bool operator==(const const_iterator& rhs) const noexcept {
+                return this->node == rhs.node;
+            }
+
+        };
+
+        class iterator {
+        private:
+            /* ---------------------------------------------Fields-------------------------------------------------- */
+            const index_singly_list* parent;
+
+            index_type node;
+
+            /* -------------------------------------------Constructors---------------------------------------------- */
+            constexpr iterator(const index_singly_list* parent, index_type node) noexcept
+                : parent(parent), node(node) {}
+
+            /* ---------------------------------------------Friends------------------------------------------------- */
+            friend class index_singly_list;
+
+        public:
+            /* -------------------------------------------Definitions----------------------------------------------- */
+            using iterator_category = std::forward_iterator_tag;
+
+            using value_type = typename index_singly_list::value_type;
+
+            using difference_type = typename index_singly_list::difference_type;
+
+            using reference = value_type&;
+
+            using pointer = value_type*;
+
+            /* ------------------------------------------Constructors----------------------------------------------- */
+            constexpr iterator() noexcept : parent(nullptr), node(_null) {}
+
+            /* ---------------------------------------Overloaded Operators------------------------------------------ */
+            [[nodiscard]] constexpr reference operator*() const {
+                if (!const_iterator(*this)._is_dereferenceable()) {
+                    throw std::runtime_error("segmentation fault");
+                }
+                return this->parent->_value(this->node);
+            }
+
+            [[nodiscard]] constexpr pointer operator->() const { return &(**this); }
+
+            constexpr iterator& operator++() {
+                if (this->node == _null) {
+                    throw std::runtime_error("segmentation fault");
+                }
+                this->node = this->parent->_next(this->node);
+                return *this;
+            }
+
+            constexpr iterator operator++(int) {
+                iterator temp = *this;
+                ++(*this);
+                return temp;
+            }
+
+            [[nodiscard]] constexpr bool operator==(const iterator& rhs) const noexcept {
+                return this->node == rhs.node;
+            }
+
+            [[nodiscard]] constexpr operator const_iterator() const noexcept {
+                return const_iterator(this->parent, this->node);
+            }
+
+        };
+
+    private:
+        /* ------------------------------------------------Methods-------------------------------------------------- */
+        constexpr void _check_position(const const_iterator& pos, const char* method) const {
+            if (pos.node == _null) {
+                throw std::runtime_error("segmentation fault");
+            }
+
+            if (pos.parent != this) {
+                throw std::invalid_argument(
+                    std::string(method) +
+                    "() error: \"pos\" must belong to the same instance of adt::index_singly_list as *this"
+                );
+            }
+        }
+
+    public:
+        /* -----------------------------------------------Definitions----------------------------------------------- */
+        // Bytes taken by the node of one element
+        static constexpr size_type node_size = sizeof(_Node);
+
+        /* ----------------------------------------------Constructors----------------------------------------------- */
+        constexpr index_singly_list() noexcept : index_singly_list(allocator_type()) {}
+
+        explicit constexpr index_singly_list(const allocator_type& allocator) noexcept
+            : nodes(nullptr), node_allocator(allocator), cap(0), used(0), free_nodes(_null), first(_null),
+              last(_before_begin), sz(0) {}
+
+        explicit constexpr index_singly_list(size_type size, const allocator_type& allocator = allocator_type())
+            : index_singly_list(allocator) {
+            this->reserve(size);
+            for (size_type i = 0; i < size; i++) {
+                this->_insert_after(this->last);
+            }
+        }
+
+        constexpr index_singly_list(size_type size, const_reference value,
+                                    const allocator_type& allocator = allocator_type())
+            : index_singly_list(allocator) {
+            this->reserve(size);
+            for (size_type i = 0; i < size; i++) {
+                this->_insert_after(this->last, value);
+            }
+        }
+
+        template<std::input_iterator InputIt>
+        constexpr index_singly_list(InputIt first, InputIt last, const allocator_type& allocator = allocator_type())
+            : index_singly_list(allocator) {
+            if constexpr (std::forward_iterator<InputIt>) {
+                this->reserve(static_cast<size_type>(std::distance(first, last)));
+            }
+
+            for (; first != last; ++first) {
+                this->_insert_after(this->last, *first);
+            }
+        }
+
+        constexpr index_singly_list(std::initializer_list<value_type> values,
+                                    const allocator_type& allocator = allocator_type())
+            : index_singly_list(values.begin(), values.end(), allocator) {}
+
+        // The copy is compact: its elements are laid out in the arena in traversal order
+        constexpr index_singly_list(const index_singly_list& other)
+            : index_singly_list(other.begin(), other.end(),
+                                allocator_traits::select_on_container_copy_construction(other.get_allocator())) {}
+
+        // Takes the arena of `other` without allocating, leaving it empty
+        constexpr index_singly_list(index_singly_list&& other) noexcept : node_allocator(other.node_allocator) {
+            this->_steal(other);
+        }
+
+        /* -----------------------------------------------Destructor------------------------------------------------ */
+        constexpr ~index_singly_list() noexcept {
+            this->_clear();
+            this->_deallocate_arena(this->nodes, this->cap);
+        }
+
+        /* ------------------------------------------Overloaded Operators------------------------------------------- */
+        constexpr index_singly_list& operator=(const index_singly_list& rhs) {
+            if (this == &rhs) {
+                return *this;
+            }
+
+            if constexpr (allocator_traits::propagate_on_container_copy_assignment::value) {
+                // The arena must be freed by the allocator that created it before that allocator is replaced
+                if (!this->_is_allocator_equal(rhs)) {
+                    this->_clear();
+                    this->_deallocate_arena(this->nodes, this->cap);
+                    this->nodes = nullptr;
+                    this->cap = 0;
+                }
+                this->node_allocator = rhs.node_allocator;
+            }
+
+            this->assign(rhs.begin(), rhs.end());
+            return *this;
+        }
+
+        constexpr index_singly_list& operator=(index_singly_list&& rhs)
+            noexcept(allocator_traits::propagate_on_container_move_assignment::value ||
+                     allocator_traits::is_always_equal::value) {
+            if (this == &rhs) {
+                return *this;
+            }
+
+            this->_clear();
+
+            if constexpr (!allocator_traits::propagate_on_container_move_assignment::value) {
+                // Our allocator cannot free the arena of `rhs`, so only the elements move, into our own arena
+                if (!this->_is_allocator_equal(rhs)) {
+                    this->_move_elements(rhs);
+                    return *this;
+                }
+            }
+
+            this->_deallocate_arena(this->nodes, this->cap);
+            if constexpr (allocator_traits::propagate_on_container_move_assignment::value) {
+                this->node_allocator = rhs.node_allocator;
+            }
+            this->_steal(rhs);
+
+            return *this;
+        }
+
+        constexpr index_singly_list& operator=(std::initializer_list<value_type> values) {
+            this->assign(values.begin(), values.end());
+            return *this;
+        }
+
+        [[nodiscard]] constexpr bool operator==(const index_singly_list& rhs) const {
+            return this->sz == rhs.sz && std::equal(this->begin(), this->end(), rhs.begin());
+        }
+
+        [[nodiscard]] constexpr auto operator<=>(const index_singly_list& rhs) const
+            requires (std::three_way_comparable<value_type>) {
+            return std::lexicographical_compare_three_way(this->begin(), this->end(), rhs.begin(), rhs.end());
+        }
+
+        /* ------------------------------------------------Methods-------------------------------------------------- */
+        [[nodiscard]] constexpr iterator before_begin() noexcept { return iterator(this, _before_begin); }
+
+        [[nodiscard]] constexpr const_iterator before_begin() const noexcept {
+            return const_iterator(this, _before_begin);
+        }
+
+        [[nodiscard]] constexpr const_iterator cbefore_begin() const noexcept { return this->before_begin(); }
+
+        [[nodiscard]] constexpr iterator begin() noexcept { return iterator(this, this->first); }
+
+        [[nodiscard]] constexpr const_iterator begin() const noexcept { return const_iterator(this, this->first); }
+
+        [[nodiscard]] constexpr const_iterator cbegin() const noexcept { return this->begin(); }
+
+        [[nodiscard]] constexpr iterator end() noexcept { return iterator(this, _null); }
+
+        [[nodiscard]] constexpr const_iterator end() const noexcept { return const_iterator(this, _null); }
+
+        [[nodiscard]] constexpr const_iterator cend() const noexcept { return this->end(); }
+
+        // Overwrites the existing elements in place, creates only the elements missing and erases only those left over
+        template<std::input_iterator InputIt>
+        constexpr void assign(InputIt first, InputIt last) {
+            index_type prev = _before_begin;
+
+            for (; first != last && this->_next(prev) != _null; ++first) {
+                prev = this->_next(prev);
+                this->_value(prev) = *first;
+            }
+
+            for (; first != last; ++first) {
+                prev = this->_insert_after(prev, *first);
+            }
+
+            while (this->_next(prev) != _null) {
+                this->_erase_after(prev);
+            }
+        }
+
+        constexpr void assign(std::initializer_list<value_type> values) { this->assign(values.begin(), values.end()); }
+
+        [[nodiscard]] constexpr allocator_type get_allocator() const noexcept {
+            return allocator_type(this->node_allocator);
+        }
+
+        [[nodiscard]] constexpr reference front() {
+            if (this->first != _null) {
+                return this->_value(this->first);
+            }
+            throw std::runtime_error("segmentation fault");
+        }
+
+        [[nodiscard]] constexpr const_reference front() const {
+            return const_cast<index_singly_list*>(this)->front();
+        }
+
+        [[nodiscard]] constexpr reference back() {
+            if (this->first != _null) {
+                return this->_value(this->last);
+            }
+            throw std::runtime_error("segmentation fault");
+        }
+
+        [[nodiscard]] constexpr const_reference back() const { return const_cast<index_singly_list*>(this)->back(); }
+
+        [[nodiscard]] constexpr size_type size() const noexcept { return this->sz; }
+
+        // Two index values are reserved for the end() and before_begin() positions
+        [[nodiscard]] constexpr size_type max_size() const noexcept {
+            return std::min<size_type>(_before_begin, node_allocator_traits::max_size(this->node_allocator));
+        }
+
+        [[nodiscard]] constexpr bool empty() const noexcept { return this->sz == 0; }
+
+        // Number of elements the list can hold before its arena grows
+        [[nodiscard]] constexpr size_type capacity() const noexcept { return this->cap; }
+
+        constexpr void reserve(size_type capacity) {
+            if (capacity <= this->cap) {
+                return;
+            }
+
+            if (capacity > this->max_size()) {
+                throw std::length_error("reserve() error: \"capacity\" exceeds max_size()");
+            }
+
+            _Node* arena = this->_allocate_arena(capacity);
+            try {
+                this->_relocate(arena, capacity);
+            } catch (...) {
+                this->_deallocate_arena(arena, capacity);
+                throw;
+            }
+        }
+
+        // Moves the elements into an arena of exactly size() nodes, laid out in traversal order so that iteration walks
+        // memory sequentially again. Invalidates every iterator, pointer and reference into the list
+        constexpr void shrink_to_fit() {
+            // Nothing to do if the arena is full and already in traversal order, as after a copy
+            if (this->sz == this->cap && this->_is_sequential()) {
+                return;
+            }
+
+            _Node* arena = (this->sz > 0) ? this->_allocate_arena(this->sz) : nullptr;
+            index_type count = 0;
+
+            // As in _relocate(), a throwing copy leaves the list unchanged
+            try {
+                for (index_type i = this->first; i != _null; i = this->nodes[i].next) {
+                    std::construct_at(std::addressof(arena[count].value), std::move_if_noexcept(this->nodes[i].value));
+                    arena[count].next = count + 1;
+                    count++;
+                }
+            } catch (...) {
+                for (index_type i = 0; i < count; i++) {
+                    std::destroy_at(std::addressof(arena[i].value));
+                }
+                this->_deallocate_arena(arena, this->sz);
+                throw;
+            }
+
+            for (index_type i = this->first; i != _null; i = this->nodes[i].next) {
+                std::destroy_at(std::addressof(this->nodes[i].value));
+            }
+            this->_deallocate_arena(this->nodes, this->cap);
+            this->nodes = arena;
+            this->cap = this->used = this->sz;
+            this->free_nodes = _null;
+
+            if (this->sz > 0) {
+                this->nodes[this->sz - 1].next = _null;
+                this->first = 0;
+                this->last = this->sz - 1;
+            }
+        }
+
+        // Destroys every element; the arena is kept for the next insertions
+        constexpr void clear() noexcept { this->_clear(); }
+
+        template<class... Args>
+        constexpr reference emplace_front(Args&&... args) {
+            return this->_value(this->_insert_after(_before_begin, std::forward<Args>(args)...));
+        }
+
+        template<class... Args>
+        constexpr reference emplace_back(Args&&... args) {
+            return this->_value(this->_insert_after(this->last, std::forward<Args>(args)...));
+        }
+
+        constexpr void push_front(const_reference value) { this->emplace_front(value); }
+
+        constexpr void push_front(value_type&& value) { this->emplace_front(std::move(value)); }
+
+        constexpr void push_back(const_reference value) { this->emplace_back(value); }
+
+        constexpr void push_back(value_type&& value) { this->emplace_back(std::move(value)); }
+
+        constexpr void pop_front() {
+            if (this->first == _null) {
+                throw std::runtime_error("cannot pop from an empty list");
+            }
+
+            this->_erase_after(_before_begin);
+        }
+
+        template<class... Args>
+        constexpr iterator emplace_after(const_iterator pos, Args&&... args) {
+            this->_check_position(pos, "emplace_after");
+            return iterator(this, this->_insert_after(pos.node, std::forward<Args>(args)...));
+        }
+
+        constexpr iterator insert_after(const_iterator pos, const_reference value) {
+            this->_check_position(pos, "insert_after");
+            return iterator(this, this->_insert_after(pos.node, value));
+        }
+
+        constexpr iterator insert_after(const_iterator pos, value_type&& value) {
+            this->_check_position(pos, "insert_after");
+            return iterator(this, this->_insert_after(pos.node, std::move(value)));
+        }
+
+        // Erases the element after `pos`. Returns the position of the element that followed it
+        constexpr iterator erase_after(const_iterator pos) {
+            this->_check_position(pos, "erase_after");
+
+            if (this->_next(pos.node) == _null) {
+                throw std::runtime_error("segmentation fault");
+            }
+
+            return iterator(this, this->_erase_after(pos.node));
+        }
+
+        // Erases the elements in (`first`, `last`). Returns `last`
+        constexpr iterator erase_after(const_iterator first, const_iterator last) {
+            this->_check_position(first, "erase_after");
+
+            while (this->_next(first.node) != last.node) {
+                this->_erase_after(first.node);
+            }
+
+            return iterator(this, last.node);
+        }
+
+        constexpr size_type remove(const_reference value) {
+            return this->remove_if([&](const_reference element) -> bool { return element == value; });
+        }
+
+        template<class Predicate>
+        constexpr size_type remove_if(Predicate pred) requires (std::predicate<Predicate&, const_reference>) {
+            index_type prev = _before_begin;
+            size_type removed = 0;
+
+            while (this->_next(prev) != _null) {
+                if (pred(std::as_const(this->_value(this->_next(prev))))) {
+                    this->_erase_after(prev);
+                    removed++;
+                } else {
+                    prev = this->_next(prev);
+                }
+            }
+
+            return removed;
+        }
+
+        constexpr void reverse() noexcept {
+            index_type prev = _null,
+                       curr = this->first,
+                       next;
+
+            // The old front becomes the new tail
+            if (curr != _null) {
+                this->last = curr;
+            }
+
+            while (curr != _null) {
+                next = this->nodes[curr].next;
+                this->nodes[curr].next = prev;
+                prev = curr;
+                curr = next;
+            }
+
+            this->first = prev;
+        }
+
+        constexpr void sort() { this->sort(std::less<value_type>{}); }
+
+        // Stable merge sort that only relinks the nodes
+        template<class Compare>
+        constexpr void sort(Compare comp) {
+            this->first = this->_merge_sort(this->first, comp);
+
+            // Find the new tail of the sorted list
+            while (this->_next(this->last) != _null) {
+                this->last = this->_next(this->last);
+            }
+        }
+
+        // Exchanges the arenas of both lists in O(1). Unless the allocator propagates on swap, both allocators must
+        // compare equal, as for the standard containers
+        constexpr void swap(index_singly_list& other) noexcept {
+            if constexpr (allocator_traits::propagate_on_container_swap::value) {
+                std::swap(this->node_allocator, other.node_allocator);
+            }
+
+            std::swap(this->nodes, other.nodes);
+            std::swap(this->cap, other.cap);
+            std::swap(this->used, other.used);
+            std::swap(this->free_nodes, other.free_nodes);
+            std::swap(this->first, other.first);
+            std::swap(this->last, other.last);
+            std::swap(this->sz, other.sz);
+        }
+
+    };
+
+    /* ----------------------------------------Non-Member Functions------------------------------------------------- */
+    template<class T, std::unsigned_integral Index, class Allocator>
+    constexpr void swap(index_singly_list<T, Index, Allocator>& lhs,
+                        index_singly_list<T, Index, Allocator>& rhs) noexcept {
+        lhs.swap(rhs);
+    }
+
+} // adt
+
+
+#endif // INDEX_SINGLY_LIST_HPP
@@ -0,0 +1,92 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+#include <forward_list> // baseline to compare against
+
+#include "singly_list.hpp"
+#include "index_singly_list.hpp"
+
+
+/* -------------------------------------------Definitions---------------------------------------------------- */
+using value_type = int;
+
+/* -------------------------------------------Build Benchmarks----------------------------------------------- */
+template<class Container>
+static void bench_build(benchmark::State& state) {
+	const std::size_t n = static_cast<std::size_t>(state.range(0));
+
+	for (auto _ : state) {
+		Container container;
+
+		for (std::size_t i = 0; i < n; i++) {
+			container.push_front(static_cast<value_type>(i));
+		}
+		benchmark::DoNotOptimize(container.front());
+	}
+
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(bench_build<adt::singly_list<value_type>>)->Name("build<adt::singly_list>")->Arg(1'000)->Arg(1'000'000);
+BENCHMARK(bench_build<std::forward_list<value_type>>)->Name("build<std::forward_list>")->Arg(1'000)->Arg(1'000'000);
+BENCHMARK(bench_build<adt::index_singly_list<value_type>>)->Name("build<adt::index_singly_list>")
+	->Arg(1'000)->Arg(1'000'000);
+
+/* -----------------------------------------Traversal Benchmarks--------------------------------------------- */
+// Sums the elements of many small lists built in interleaved order, as in a table of per-key lists filled over time
+template<class Container>
+static void bench_many_small_lists(benchmark::State& state) {
+	const std::size_t list_count = static_cast<std::size_t>(state.range(0)),
+					  list_size = 16;
+	std::vector<Container> lists(list_count);
+
+	for (std::size_t i = 0; i < list_size; i++) {
+		for (Container& list : lists) {
+			list.push_front(static_cast<typename Container::value_type>(i));
+		}
+	}
+
+	for (auto _ : state) {
+		std::int64_t sum = 0;
+
+		for (const Container& list : lists) {
+			for (const auto& value : list) {
+				sum += value;
+			}
+		}
+		benchmark::DoNotOptimize(sum);
+	}
+
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * list_count * list_size));
+}
+BENCHMARK(bench_many_small_lists<adt::singly_list<value_type>>)->Name("many_small_lists<adt::singly_list>")
+	->Arg(1'000)->Arg(100'000);
+BENCHMARK(bench_many_small_lists<adt::index_singly_list<value_type>>)
+	->Name("many_small_lists<adt::index_singly_list>")->Arg(1'000)->Arg(100'000);
+BENCHMARK(bench_many_small_lists<adt::index_singly_list<std::int16_t, std::uint16_t>>)
+	->Name("many_small_lists<adt::index_singly_list, uint16>")->Arg(1'000)->Arg(100'000);
+
+// Sums the elements of one long list whose nodes were reached in the same order they were created
+template<class Container>
+static void bench_iterate(benchmark::State& state) {
+	const std::size_t n = static_cast<std::size_t>(state.range(0));
+	Container container;
+
+	for (std::size_t i = 0; i < n; i++) {
+		container.push_front(static_cast<value_type>(i));
+	}
+
+	for (auto _ : state) {
+		std::int64_t sum = 0;
+
+		for (const value_type& value : container) {
+			sum += value;
+		}
+		benchmark::DoNotOptimize(sum);
+	}
+
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(bench_iterate<adt::singly_list<value_type>>)->Name("iterate<adt::singly_list>")->Arg(1'000'000);
+BENCHMARK(bench_iterate<adt::index_singly_list<value_type>>)->Name("iterate<adt::index_singly_list>")
+	->Arg(1'000'000);
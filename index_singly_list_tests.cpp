@@ -0,0 +1,531 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include "index_singly_list.hpp"
+
+
+/* -------------------------------------------Definitions---------------------------------------------------- */
+using list_type = adt::index_singly_list<int>;
+
+namespace {
+
+	// Counts the instances alive, to check that every element is destroyed
+	struct tracked {
+		static inline int alive = 0;
+
+		int value = 0;
+
+		tracked() { alive++; }
+
+		tracked(int value) : value(value) { alive++; }
+
+		tracked(const tracked& other) : value(other.value) { alive++; }
+
+		tracked& operator=(const tracked&) = default;
+
+		~tracked() { alive--; }
+	};
+
+	// Counts the instances alive like `tracked`, but its constructors throw once `countdown` constructions have
+	// succeeded. It has no move constructor, so growing the arena copies it
+	struct throwing {
+		static inline int alive = 0;
+
+		static inline int countdown = -1;
+
+		int value = 0;
+
+		throwing(int value) : value(value) { construct(); }
+
+		throwing(const throwing& other) : value(other.value) { construct(); }
+
+		throwing& operator=(const throwing&) = default;
+
+		~throwing() { alive--; }
+
+		bool operator==(const throwing&) const = default;
+
+		static void construct() {
+			if (countdown == 0) {
+				throw std::runtime_error("throwing() error: construction failed");
+			}
+			countdown--;
+			alive++;
+		}
+	};
+
+	// A stateful allocator that counts the arenas it allocates and frees; instances compare equal only when they share
+	// the same `id`, and propagate on copy and move assignment only if `Propagate` is true
+	template<class T, bool Propagate>
+	struct counting_allocator {
+		using value_type = T;
+
+		using propagate_on_container_copy_assignment = std::bool_constant<Propagate>;
+
+		using propagate_on_container_move_assignment = std::bool_constant<Propagate>;
+
+		using is_always_equal = std::false_type;
+
+		template<class U>
+		struct rebind {
+			using other = counting_allocator<U, Propagate>;
+		};
+
+		int id;
+
+		int* live;
+
+		counting_allocator(int id, int* live) : id(id), live(live) {}
+
+		template<class U>
+		counting_allocator(const counting_allocator<U, Propagate>& other) : id(other.id), live(other.live) {}
+
+		T* allocate(std::size_t n) {
+			(*this->live)++;
+			return std::allocator<T>().allocate(n);
+		}
+
+		void deallocate(T* ptr, std::size_t n) {
+			(*this->live)--;
+			std::allocator<T>().deallocate(ptr, n);
+		}
+
+		template<class U>
+		bool operator==(const counting_allocator<U, Propagate>& rhs) const { return this->id == rhs.id; }
+	};
+
+	template<bool Propagate>
+	using counted_list_type = adt::index_singly_list<int, std::uint32_t, counting_allocator<int, Propagate>>;
+
+	// How many nodes apart `lhs` and `rhs` are in the arena of `List`
+	template<class List, class T>
+	std::ptrdiff_t node_distance(const T& lhs, const T& rhs) {
+		return (reinterpret_cast<const std::byte*>(&rhs) - reinterpret_cast<const std::byte*>(&lhs)) /
+			static_cast<std::ptrdiff_t>(List::node_size);
+	}
+
+} // namespace
+
+/* ----------------------------------Index Singly List Constructors Tests------------------------------------ */
+TEST(index_singly_list__constructors, default_constructor) {
+	list_type list;
+
+	EXPECT_TRUE(list.empty());
+	EXPECT_EQ(list.size(), 0);
+	EXPECT_EQ(list.capacity(), 0);
+	EXPECT_EQ(list.begin(), list.end());
+	EXPECT_THROW(static_cast<void>(list.front()), std::runtime_error);
+	EXPECT_THROW(static_cast<void>(list.back()), std::runtime_error);
+}
+
+TEST(index_singly_list__constructors, initializer_list_constructor) {
+	list_type list = {1, 2, 3, 4};
+
+	EXPECT_EQ(list, list_type({1, 2, 3, 4}));
+	EXPECT_EQ(list.size(), 4);
+	EXPECT_EQ(list.capacity(), 4);
+	EXPECT_EQ(list.front(), 1);
+	EXPECT_EQ(list.back(), 4);
+}
+
+TEST(index_singly_list__constructors, size_constructor) {
+	list_type list(3),
+			  filled(4, 7);
+
+	EXPECT_EQ(list, list_type({0, 0, 0}));
+	EXPECT_EQ(filled, list_type({7, 7, 7, 7}));
+}
+
+TEST(index_singly_list__constructors, copy_constructor) {
+	list_type list = {1, 2, 3, 4, 5};
+
+	list.erase_after(list.begin());
+	list.push_front(0);
+
+	list_type list_copy(list);
+
+	EXPECT_EQ(list_copy, list_type({0, 1, 3, 4, 5}));
+	EXPECT_EQ(list_copy.capacity(), 5);
+	EXPECT_EQ(node_distance<list_type>(list_copy.front(), list_copy.back()), 4);
+}
+
+TEST(index_singly_list__constructors, move_constructor) {
+	list_type list = {1, 2, 3};
+	const int* front = &list.front();
+	list_type list_move(std::move(list));
+
+	EXPECT_EQ(list_move, list_type({1, 2, 3}));
+	EXPECT_EQ(&list_move.front(), front);
+	EXPECT_TRUE(list.empty());
+	EXPECT_EQ(list.capacity(), 0);
+
+	list.push_back(4);
+	EXPECT_EQ(list, list_type({4}));
+}
+
+/* -----------------------------------Index Singly List Operators Tests-------------------------------------- */
+TEST(index_singly_list__operators, copy_assignment) {
+	list_type list = {1, 2, 3},
+			  longer = {4, 5, 6, 7, 8},
+			  shorter = {9};
+
+	longer = list;
+	shorter = list;
+
+	EXPECT_EQ(longer, list);
+	EXPECT_EQ(longer.back(), 3);
+	EXPECT_EQ(shorter, list);
+
+	// Surplus nodes were freed, not dropped from the arena
+	EXPECT_EQ(longer.capacity(), 5);
+	longer.push_back(4);
+	longer.push_back(5);
+	EXPECT_EQ(longer.capacity(), 5);
+}
+
+TEST(index_singly_list__operators, move_assignment) {
+	list_type list = {1, 2, 3},
+			  other = {4, 5};
+
+	other = std::move(list);
+
+	EXPECT_EQ(other, list_type({1, 2, 3}));
+	EXPECT_TRUE(list.empty());
+}
+
+TEST(index_singly_list__operators, move_assignment__propagating_allocator) {
+	int src_live = 0,
+		dst_live = 0;
+	{
+		counted_list_type<true> src({1, 2, 3}, counting_allocator<int, true>(1, &src_live)),
+								dst({4, 5}, counting_allocator<int, true>(2, &dst_live));
+		const int* front = &src.front();
+
+		dst = std::move(src);
+
+		// The arena of `dst` was freed and that of `src` was taken along with its allocator
+		EXPECT_EQ(dst_live, 0);
+		EXPECT_EQ(dst.get_allocator().id, 1);
+		EXPECT_EQ(&dst.front(), front);
+		EXPECT_TRUE(src.empty());
+	}
+
+	EXPECT_EQ(src_live, 0);
+	EXPECT_EQ(dst_live, 0);
+}
+
+TEST(index_singly_list__operators, move_assignment__unequal_allocator__moves_elements) {
+	int src_live = 0,
+		dst_live = 0;
+	{
+		counted_list_type<false> src({1, 2, 3}, counting_allocator<int, false>(1, &src_live)),
+								 dst({4, 5}, counting_allocator<int, false>(2, &dst_live));
+		const int* front = &src.front();
+
+		dst = std::move(src);
+
+		// The allocator does not propagate, so the elements moved into an arena from `dst`'s allocator
+		EXPECT_EQ(dst.get_allocator().id, 2);
+		EXPECT_NE(&dst.front(), front);
+		EXPECT_EQ(dst.size(), 3);
+		EXPECT_EQ(dst.back(), 3);
+		EXPECT_TRUE(src.empty());
+	}
+
+	// Every arena was freed by the allocator that created it
+	EXPECT_EQ(src_live, 0);
+	EXPECT_EQ(dst_live, 0);
+}
+
+TEST(index_singly_list__operators, copy_assignment__propagating_allocator) {
+	int src_live = 0,
+		dst_live = 0;
+	{
+		counted_list_type<true> src({1, 2, 3}, counting_allocator<int, true>(1, &src_live)),
+								dst({4, 5, 6, 7}, counting_allocator<int, true>(2, &dst_live));
+
+		dst = src;
+
+		EXPECT_EQ(dst.get_allocator().id, 1);
+		EXPECT_EQ(dst_live, 0);
+		EXPECT_EQ(src_live, 2);
+		EXPECT_EQ(dst.size(), 3);
+		EXPECT_EQ(dst.back(), 3);
+	}
+
+	EXPECT_EQ(src_live, 0);
+	EXPECT_EQ(dst_live, 0);
+}
+
+TEST(index_singly_list__operators, comparison) {
+	list_type list = {1, 2, 3};
+
+	EXPECT_EQ(list, list_type({1, 2, 3}));
+	EXPECT_NE(list, list_type({1, 2}));
+	EXPECT_LT(list, list_type({1, 2, 4}));
+	EXPECT_GT(list, list_type({1, 2}));
+}
+
+/* ------------------------------------Index Singly List Methods Tests--------------------------------------- */
+TEST(index_singly_list__methods, node_size) {
+	// A 32-bit index halves the node of an int compared to a pointer on 64-bit builds
+	EXPECT_EQ(list_type::node_size, 2 * sizeof(int));
+	EXPECT_EQ((adt::index_singly_list<std::uint16_t, std::uint16_t>::node_size), 2 * sizeof(std::uint16_t));
+}
+
+TEST(index_singly_list__methods, push_pop) {
+	list_type list;
+
+	list.push_back(2);
+	list.push_front(1);
+	list.emplace_back(3);
+	EXPECT_EQ(list, list_type({1, 2, 3}));
+
+	list.pop_front();
+	list.pop_front();
+	list.pop_front();
+	EXPECT_TRUE(list.empty());
+	EXPECT_THROW(list.pop_front(), std::runtime_error);
+
+	list.push_back(4);
+	EXPECT_EQ(list.front(), 4);
+	EXPECT_EQ(list.back(), 4);
+}
+
+TEST(index_singly_list__methods, growth__keeps_iterators) {
+	list_type list = {1};
+	auto first = list.begin();
+
+	for (int i = 2; i <= 100; i++) {
+		list.push_back(i);
+	}
+
+	EXPECT_GE(list.capacity(), 100);
+	EXPECT_EQ(*first, 1);
+	EXPECT_EQ(*std::next(first, 99), 100);
+}
+
+TEST(index_singly_list__methods, growth__argument_from_list) {
+	list_type list = {1, 2, 3, 4, 5, 6, 7, 8};
+	ASSERT_EQ(list.size(), list.capacity());
+
+	// The argument refers into the arena that is about to be replaced
+	list.push_back(list.front());
+	list.push_front(list.back());
+
+	EXPECT_EQ(list, list_type({1, 1, 2, 3, 4, 5, 6, 7, 8, 1}));
+}
+
+TEST(index_singly_list__methods, erase__reuses_nodes) {
+	list_type list = {1, 2, 3, 4};
+
+	list.pop_front();
+	list.erase_after(list.begin());
+	EXPECT_EQ(list, list_type({2, 4}));
+
+	list.push_front(5);
+	list.push_back(6);
+	EXPECT_EQ(list, list_type({5, 2, 4, 6}));
+	EXPECT_EQ(list.capacity(), 4);
+}
+
+TEST(index_singly_list__methods, insert_after) {
+	list_type list = {1, 3};
+
+	auto it = list.insert_after(list.begin(), 2);
+	EXPECT_EQ(*it, 2);
+
+	it = list.emplace_after(std::next(it), 4);
+	EXPECT_EQ(list, list_type({1, 2, 3, 4}));
+	EXPECT_EQ(&list.back(), &*it);
+
+	list.insert_after(list.before_begin(), 0);
+	EXPECT_EQ(list.front(), 0);
+}
+
+TEST(index_singly_list__methods, insert_after__invalid_position) {
+	list_type list = {1},
+			  other = {2};
+
+	EXPECT_THROW(list.insert_after(other.begin(), 3), std::invalid_argument);
+	EXPECT_THROW(list.insert_after(list.end(), 3), std::runtime_error);
+}
+
+TEST(index_singly_list__methods, erase_after) {
+	list_type list = {1, 2, 3, 4, 5};
+
+	auto it = list.erase_after(list.begin());
+	EXPECT_EQ(*it, 3);
+
+	it = list.erase_after(list.begin(), std::next(list.begin(), 3));
+	EXPECT_EQ(*it, 5);
+	EXPECT_EQ(list, list_type({1, 5}));
+
+	list.erase_after(list.begin());
+	EXPECT_EQ(list.back(), 1);
+	EXPECT_THROW(list.erase_after(list.begin()), std::runtime_error);
+}
+
+TEST(index_singly_list__methods, clear) {
+	list_type list = {1, 2, 3};
+
+	list.clear();
+	EXPECT_TRUE(list.empty());
+	EXPECT_EQ(list.capacity(), 3);
+
+	list = {4, 5, 6};
+	EXPECT_EQ(list, list_type({4, 5, 6}));
+	EXPECT_EQ(list.capacity(), 3);
+}
+
+TEST(index_singly_list__methods, remove_if) {
+	list_type list = {1, 2, 3, 4, 5, 6};
+
+	EXPECT_EQ(list.remove_if([](int value) { return value % 2 == 0; }), 3);
+	EXPECT_EQ(list, list_type({1, 3, 5}));
+	EXPECT_EQ(list.back(), 5);
+
+	EXPECT_EQ(list.remove(5), 1);
+	EXPECT_EQ(list.back(), 3);
+}
+
+TEST(index_singly_list__methods, reverse) {
+	list_type list = {1, 2, 3, 4};
+
+	list.reverse();
+	EXPECT_EQ(list, list_type({4, 3, 2, 1}));
+
+	list.push_back(0);
+	EXPECT_EQ(list.back(), 0);
+}
+
+TEST(index_singly_list__methods, sort) {
+	list_type list = {5, 3, 6, 1, 4, 2};
+
+	list.sort();
+	EXPECT_EQ(list, list_type({1, 2, 3, 4, 5, 6}));
+	EXPECT_EQ(list.back(), 6);
+
+	// Stable: elements with the same parity keep their relative order
+	list.sort([](int lhs, int rhs) { return lhs % 2 < rhs % 2; });
+	EXPECT_EQ(list, list_type({2, 4, 6, 1, 3, 5}));
+	EXPECT_EQ(list.back(), 5);
+}
+
+TEST(index_singly_list__methods, shrink_to_fit) {
+	list_type list;
+
+	for (int i = 0; i < 20; i++) {
+		list.push_front(i);
+	}
+	list.remove_if([](int value) { return value >= 10; });
+	list.shrink_to_fit();
+
+	EXPECT_EQ(list.capacity(), 10);
+	EXPECT_EQ(list, list_type({9, 8, 7, 6, 5, 4, 3, 2, 1, 0}));
+
+	// Elements are laid out in traversal order
+	EXPECT_EQ(node_distance<list_type>(list.front(), list.back()), 9);
+
+	list.push_back(-1);
+	EXPECT_EQ(list.back(), -1);
+}
+
+TEST(index_singly_list__methods, shrink_to_fit__full_arena_out_of_order) {
+	list_type list = {4, 2, 3, 1};
+	ASSERT_EQ(list.size(), list.capacity());
+
+	// Sorting relinks the nodes without moving them, so the arena is full but no longer in traversal order
+	list.sort();
+	ASSERT_NE(node_distance<list_type>(list.front(), list.back()), 3);
+
+	list.shrink_to_fit();
+	EXPECT_EQ(list, list_type({1, 2, 3, 4}));
+	EXPECT_EQ(list.capacity(), 4);
+	EXPECT_EQ(node_distance<list_type>(list.front(), list.back()), 3);
+}
+
+TEST(index_singly_list__methods, growth__throwing_element) {
+	{
+		adt::index_singly_list<throwing> list = {1, 2, 3, 4, 5, 6, 7, 8};
+		ASSERT_EQ(list.size(), list.capacity());
+
+		// The new element throws before the elements are copied into the new arena
+		throwing::countdown = 0;
+		EXPECT_THROW(list.emplace_back(9), std::runtime_error);
+
+		// The new element is built, then the 4th copy into the new arena throws
+		throwing::countdown = 4;
+		EXPECT_THROW(list.emplace_back(9), std::runtime_error);
+
+		// Same for shrink_to_fit(), once the arena has a free node to drop
+		list.pop_front();
+		throwing::countdown = 2;
+		EXPECT_THROW(list.shrink_to_fit(), std::runtime_error);
+
+		throwing::countdown = -1;
+		EXPECT_EQ(list, adt::index_singly_list<throwing>({2, 3, 4, 5, 6, 7, 8}));
+		EXPECT_EQ(list.capacity(), 8);
+		EXPECT_EQ(throwing::alive, 7);
+	}
+
+	EXPECT_EQ(throwing::alive, 0);
+}
+
+TEST(index_singly_list__methods, max_size__small_index) {
+	adt::index_singly_list<int, std::uint8_t> list;
+
+	EXPECT_EQ(list.max_size(), 254);
+
+	for (int i = 0; i < 254; i++) {
+		list.push_front(i);
+	}
+	EXPECT_THROW(list.push_front(0), std::length_error);
+	EXPECT_EQ(list.size(), 254);
+	EXPECT_THROW(list.reserve(255), std::length_error);
+}
+
+TEST(index_singly_list__methods, swap) {
+	list_type list = {1, 2},
+			  other = {3};
+
+	swap(list, other);
+	EXPECT_EQ(list, list_type({3}));
+	EXPECT_EQ(other, list_type({1, 2}));
+}
+
+TEST(index_singly_list__methods, destructor__releases_elements) {
+	{
+		adt::index_singly_list<tracked> list = {1, 2, 3};
+
+		list.pop_front();
+		for (int i = 0; i < 10; i++) {
+			list.push_back(i);
+		}
+		list.shrink_to_fit();
+
+		adt::index_singly_list<tracked> other(list);
+		other = {4};
+		list.clear();
+	}
+
+	EXPECT_EQ(tracked::alive, 0);
+}
+
+TEST(index_singly_list__methods, non_trivial_elements) {
+	adt::index_singly_list<std::string, std::uint16_t> list;
+
+	for (int i = 0; i < 50; i++) {
+		list.push_back(std::string(20, static_cast<char>('a' + i % 26)));
+	}
+	list.sort();
+
+	EXPECT_EQ(list.front(), std::string(20, 'a'));
+	EXPECT_EQ(list.back(), std::string(20, 'z'));
+	EXPECT_TRUE(std::is_sorted(list.begin(), list.end()));
+}
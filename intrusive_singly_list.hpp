@@ -0,0 +1,627 @@
+#ifndef INTRUSIVE_SINGLY_LIST_HPP
+#define INTRUSIVE_SINGLY_LIST_HPP
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <concepts>
+#include <utility>
+
+
+namespace adt {
+
+    // The link an intrusive_singly_list<T, Tag> threads through its elements: `T` derives from it. Deriving from hooks
+    // with different tags lets the same object be in several lists at once, one per tag. Copying an object never copies
+    // its link, so a copy is not part of any list
+    template<class Tag = void>
+    class intrusive_singly_list_hook {
+    private:
+        /* ------------------------------------------------Friends-------------------------------------------------- */
+        template<class, class>
+        friend class intrusive_singly_list;
+
+        /* ------------------------------------------------Fields--------------------------------------------------- */
+        intrusive_singly_list_hook* next;
+
+    public:
+        /* ----------------------------------------------Constructors----------------------------------------------- */
+        constexpr intrusive_singly_list_hook() noexcept : next(nullptr) {}
+
+        constexpr intrusive_singly_list_hook(const intrusive_singly_list_hook&) noexcept : next(nullptr) {}
+
+        /* -----------------------------------------------Destructor------------------------------------------------ */
+        constexpr ~intrusive_singly_list_hook() noexcept = default;
+
+        /* ------------------------------------------Overloaded Operators------------------------------------------- */
+        constexpr intrusive_singly_list_hook& operator=(const intrusive_singly_list_hook&) noexcept { return *this; }
+
+    };
+
+    // A singly linked list of objects it does not own: every element embeds its own link (see
+    // intrusive_singly_list_hook), so linking, unlinking, splicing and sorting never allocate nor copy an element.
+    // Erasing an element only unlinks it. Elements must outlive their time in the list, and an object can only be in one
+    // list per hook at a time
+    template<class T, class Tag = void>
+    class intrusive_singly_list {
+    public:
+        /* -----------------------------------------------Definitions----------------------------------------------- */
+        using value_type = T;
+
+        using hook_type = intrusive_singly_list_hook<Tag>;
+
+        using size_type = std::size_t;
+
+        using difference_type = std::ptrdiff_t;
+
+        using reference = value_type&;
+
+        using const_reference = const value_type&;
+
+        using pointer = value_type*;
+
+        using const_pointer = const value_type*;
+
+        static_assert(std::derived_from<T, hook_type>,
+                      "adt::intrusive_singly_list<T, Tag> requires T to derive from adt::intrusive_singly_list_hook<Tag>");
+
+    private:
+        /* -----------------------------------------------Definitions----------------------------------------------- */
+        using _Hook = hook_type;
+
+        /* ------------------------------------------------Fields--------------------------------------------------- */
+        _Hook dummy;
+
+        _Hook* head;
+
+        _Hook* tail;
+
+        size_type sz;
+
+        /* ------------------------------------------------Methods-------------------------------------------------- */
+        [[nodiscard]] static constexpr reference _value(_Hook* hook) noexcept { return static_cast<reference>(*hook); }
+
+        [[nodiscard]] static constexpr _Hook* _hook(reference value) noexcept { return static_cast<_Hook*>(&value); }
+
+        // Links the chain `first`..`last` of `count` elements after `pos`
+        constexpr void _link_after(_Hook* pos, _Hook* first, _Hook* last, size_type count) noexcept {
+            last->next = pos->next;
+            pos->next = first;
+
+            if (pos == this->tail) {
+                this->tail = last;
+            }
+            this->sz += count;
+        }
+
+        // Unlinks the elements in (`first`, `last`) and returns the first and last of them along with their count.
+        // `last` must be reachable from `first`
+        [[nodiscard]] constexpr std::pair<std::pair<_Hook*, _Hook*>, size_type>
+        _unlink_after(_Hook* first, _Hook* last) noexcept {
+            _Hook* chain_first = first->next;
+            _Hook* chain_last = first;
+            size_type count = 0;
+
+            while (chain_last->next != last) {
+                chain_last = chain_last->next;
+                count++;
+            }
+
+            first->next = last;
+            if (chain_last == this->tail) {
+                this->tail = first;
+            }
+            this->sz -= count;
+
+            return {{chain_first, chain_last}, count};
+        }
+
+        template<class Compare>
+        static constexpr _Hook* _merge_sort_merge(_Hook* first_half, _Hook* second_half, Compare& comp) noexcept {
+            _Hook* merged = nullptr;
+            _Hook** link = &merged;
+
+            // While both halves have elements left to merge...
+            while (first_half != nullptr && second_half != nullptr) {
+                // Take from `second_half` only if it strictly precedes `first_half` to keep the merge stable
+                if (comp(_value(second_half), _value(first_half))) {
+                    *link = second_half;
+                    second_half = second_half->next;
+                } else {
+                    *link = first_half;
+                    first_half = first_half->next;
+                }
+
+                // Advance to the link of the element just merged
+                link = &((*link)->next);
+            }
+
+            // Append whatever remains of the half that was not exhausted
+            *link = (first_half != nullptr) ? first_half : second_half;
+
+            return merged;
+        }
+
+        // Bottom-up merge sort, as in adt::singly_list
+        template<class Compare>
+        static constexpr _Hook* _merge_sort(_Hook* hook, Compare& comp) noexcept {
+            // `runs[i]` holds either nullptr or a sorted run of exactly 2^i elements. Runs in higher slots always hold
+            // elements that appeared earlier in the list, which keeps the sort stable
+            _Hook* runs[std::numeric_limits<size_type>::digits] = {};
+            _Hook* carry;
+            size_type i;
+
+            while (hook != nullptr) {
+                // Detach the next element as a sorted run of length 1
+                carry = hook;
+                hook = hook->next;
+                carry->next = nullptr;
+
+                // Merge `carry` with every occupied slot, like propagating a carry in binary addition
+                for (i = 0; runs[i] != nullptr; i++) {
+                    carry = _merge_sort_merge(runs[i], carry, comp);
+                    runs[i] = nullptr;
+                }
+                runs[i] = carry;
+            }
+
+            // Merge the remaining runs from the latest (lowest slot) to the earliest (highest slot)
+            carry = nullptr;
+            for (i = 0; i < std::numeric_limits<size_type>::digits; i++) {
+                if (runs[i] != nullptr) {
+                    carry = _merge_sort_merge(runs[i], carry, comp);
+                }
+            }
+
+            return carry;
+        }
+
+    public:
+        /* -----------------------------------------------Iterators------------------------------------------------- */
+        class iterator;
+
+        class const_iterator {
+        private:
+            /* ---------------------------------------------Fields-------------------------------------------------- */
+            const intrusive_singly_list* parent;
+
+            _Hook* node;
+
+            /* -------------------------------------------Constructors---------------------------------------------- */
+            constexpr const_iterator(const intrusive_singly_list* parent, _Hook* node) noexcept
+                : parent(parent), node(node) {}
+
+            /* ---------------------------------------------Methods------------------------------------------------- */
+            [[nodiscard]] constexpr bool _is_dereferenceable() const noexcept {
+                return this->node != nullptr && this->node != this->parent->head;
+            }
+
+            /* ---------------------------------------------Friends------------------------------------------------- */
+            friend class intrusive_singly_list;
+
+            friend class iterator;
+
+        public:
+            /* -------------------------------------------Definitions----------------------------------------------- */
+            using iterator_category = std::forward_iterator_tag;
+
+            using value_type = typename intrusive_singly_list::value_type;
+
+            using difference_type = typename intrusive_singly_list::difference_type;
+
+            using reference = const value_type&;
+
+            using pointer = const value_type*;
+
+            /* ------------------------------------------Constructors----------------------------------------------- */
+            constexpr const_iterator() noexcept : parent(nullptr), node(nullptr) {}
+
+            /* ---------------------------------------Overloaded Operators------------------------------------------ */
+            [[nodiscard]] reference operator*() const {
+                if (!this->_is_dereferenceable()) {
+                    throw std::runtime_error("segmentation fault");
+                }
+                return _value(this->node);
+            }
+
+            [[nodiscard]] pointer operator->() const { return &(**this); }
+
+            const_iterator& operator++() {
+                if (this->node == nullptr) {
+                    throw std::runtime_error("segmentation fault");
+                }
+                this->node = this->node->next;
+                return *this;
+            }
+
+            const_iterator operator++(int) {
+                const_iterator temp = *this;
+                ++(*this);
+                return temp;
+            }
+
+            [[nodiscard]] constexpr bool operator==(const const_iterator& rhs) const noexcept {
+                return this->node == rhs.node;
+            }
+
+        };
+
+        class iterator {
+        private:
+            /* ---------------------------------------------Fields-------------------------------------------------- */
+            const intrusive_singly_list* parent;
+
+            _Hook* node;
+
+            /* -------------------------------------------Constructors---------------------------------------------- */
+            constexpr iterator(const intrusive_singly_list* parent, _Hook* node) noexcept : parent(parent), node(node) {}
+
+            /* ---------------------------------------------Friends------------------------------------------------- */
+            friend class intrusive_singly_list;
+
+        public:
+            /* -------------------------------------------Definitions----------------------------------------------- */
+            using iterator_category = std::forward_iterator_tag;
+
+            using value_type = typename intrusive_singly_list::value_type;
+
+            using difference_type = typename intrusive_singly_list::difference_type;
+
+            using reference = value_type&;
+
+            using pointer = value_type*;
+
+            /* ------------------------------------------Constructors----------------------------------------------- */
+            constexpr iterator() noexcept : parent(nullptr), node(nullptr) {}
+
+            /* ---------------------------------------Overloaded Operators------------------------------------------ */
+            [[nodiscard]] reference operator*() const {
+                if (!const_iterator(*this)._is_dereferenceable()) {
+                    throw std::runtime_error("segmentation fault");
+                }
+                return _value(this->node);
+            }
+
+            [[nodiscard]] pointer operator->() const { return &(**this); }
+
+            iterator& operator++() {
+                if (this->node == nullptr) {
+                    throw std::runtime_error("segmentation fault");
+                }
+                this->node = this->node->next;
+                return *this;
+            }
+
+            iterator operator++(int) {
+                iterator temp = *this;
+                ++(*this);
+                return temp;
+            }
+
+            [[nodiscard]] constexpr bool operator==(const iterator& rhs) const noexcept { return this->node == rhs.node; }
+
+            [[nodiscard]] constexpr operator const_iterator() const noexcept {
+                return const_iterator(this->parent, this->node);
+            }
+
+        };
+
+    private:
+        /* ------------------------------------------------Methods-------------------------------------------------- */
+        void _check_position(const const_iterator& pos, const char* method) const {
+            if (pos.node == nullptr) {
+                throw std::runtime_error("segmentation fault");
+            }
+
+            if (pos.parent != this) {
+                throw std::invalid_argument(
+                    std::string(method) +
+                    "() error: \"pos\" must belong to the same instance of adt::intrusive_singly_list as *this"
+                );
+            }
+        }
+
+    public:
+        /* ----------------------------------------------Constructors----------------------------------------------- */
+        constexpr intrusive_singly_list() noexcept : head(&dummy), tail(&dummy), sz(0) {}
+
+        // Links every object of [`first`, `last`) in order
+        template<std::input_iterator InputIt>
+        constexpr intrusive_singly_list(InputIt first, InputIt last) noexcept
+            requires (std::same_as<std::iter_reference_t<InputIt>, reference>)
+            : intrusive_singly_list() {
+            for (; first != last; ++first) {
+                this->push_back(*first);
+            }
+        }
+
+        intrusive_singly_list(const intrusive_singly_list&) = delete;
+
+        // Takes every element of `other` in O(1), leaving it empty
+        constexpr intrusive_singly_list(intrusive_singly_list&& other) noexcept : intrusive_singly_list() {
+            this->swap(other);
+        }
+
+        /* -----------------------------------------------Destructor------------------------------------------------ */
+        // The elements are left as they are
+        constexpr ~intrusive_singly_list() noexcept = default;
+
+        /* ------------------------------------------Overloaded Operators------------------------------------------- */
+        intrusive_singly_list& operator=(const intrusive_singly_list&) = delete;
+
+        // Unlinks the elements of the list and takes those of `rhs`, leaving it empty
+        constexpr intrusive_singly_list& operator=(intrusive_singly_list&& rhs) noexcept {
+            if (this != &rhs) {
+                this->clear();
+                this->swap(rhs);
+            }
+
+            return *this;
+        }
+
+        /* ------------------------------------------------Methods-------------------------------------------------- */
+        [[nodiscard]] constexpr iterator before_begin() noexcept { return iterator(this, this->head); }
+
+        [[nodiscard]] constexpr const_iterator before_begin() const noexcept { return const_iterator(this, this->head); }
+
+        [[nodiscard]] constexpr const_iterator cbefore_begin() const noexcept { return this->before_begin(); }
+
+        [[nodiscard]] constexpr iterator begin() noexcept { return iterator(this, this->head->next); }
+
+        [[nodiscard]] constexpr const_iterator begin() const noexcept { return const_iterator(this, this->head->next); }
+
+        [[nodiscard]] constexpr const_iterator cbegin() const noexcept { return this->begin(); }
+
+        [[nodiscard]] constexpr iterator end() noexcept { return iterator(this, nullptr); }
+
+        [[nodiscard]] constexpr const_iterator end() const noexcept { return const_iterator(this, nullptr); }
+
+        [[nodiscard]] constexpr const_iterator cend() const noexcept { return this->end(); }
+
+        // The position of `value`, which must be an element of the list, found without a traversal
+        [[nodiscard]] constexpr iterator iterator_to(reference value) noexcept { return iterator(this, _hook(value)); }
+
+        [[nodiscard]] constexpr const_iterator iterator_to(const_reference value) const noexcept {
+            return const_iterator(this, _hook(const_cast<reference>(value)));
+        }
+
+        [[nodiscard]] constexpr size_type size() const noexcept { return this->sz; }
+
+        [[nodiscard]] constexpr size_type max_size() const noexcept {
+            return std::numeric_limits<difference_type>::max();
+        }
+
+        [[nodiscard]] constexpr bool empty() const noexcept { return this->sz == 0; }
+
+        [[nodiscard]] reference front() {
+            if (this->head->next != nullptr) {
+                return _value(this->head->next);
+            }
+            throw std::runtime_error("segmentation fault");
+        }
+
+        [[nodiscard]] const_reference front() const { return const_cast<intrusive_singly_list*>(this)->front(); }
+
+        [[nodiscard]] reference back() {
+            if (this->tail != this->head) {
+                return _value(this->tail);
+            }
+            throw std::runtime_error("segmentation fault");
+        }
+
+        [[nodiscard]] const_reference back() const { return const_cast<intrusive_singly_list*>(this)->back(); }
+
+        // Unlinks every element in O(1); the elements keep their stale links until they are linked again
+        constexpr void clear() noexcept {
+            this->head->next = nullptr;
+            this->tail = this->head;
+            this->sz = 0;
+        }
+
+        constexpr void push_front(reference value) noexcept {
+            _Hook* hook = _hook(value);
+            this->_link_after(this->head, hook, hook, 1);
+        }
+
+        constexpr void push_back(reference value) noexcept {
+            _Hook* hook = _hook(value);
+            this->_link_after(this->tail, hook, hook, 1);
+        }
+
+        void pop_front() {
+            if (this->head->next == nullptr) {
+                throw std::runtime_error("cannot pop from an empty list");
+            }
+
+            static_cast<void>(this->_unlink_after(this->head, this->head->next->next));
+        }
+
+        iterator insert_after(const_iterator pos, reference value) {
+            this->_check_position(pos, "insert_after");
+
+            _Hook* hook = _hook(value);
+            this->_link_after(pos.node, hook, hook, 1);
+
+            return iterator(this, hook);
+        }
+
+        // Links every object of [`first`, `last`) in order after `pos`. Returns the position of the last one, or `pos`
+        // if the range is empty
+        template<std::input_iterator InputIt>
+        iterator insert_after(const_iterator pos, InputIt first, InputIt last)
+            requires (std::same_as<std::iter_reference_t<InputIt>, reference>) {
+            this->_check_position(pos, "insert_after");
+
+            _Hook* prev = pos.node;
+            for (; first != last; ++first) {
+                _Hook* hook = _hook(*first);
+                this->_link_after(prev, hook, hook, 1);
+                prev = hook;
+            }
+
+            return iterator(this, prev);
+        }
+
+        // Unlinks the element after `pos`. Returns the position of the element that followed it
+        iterator erase_after(const_iterator pos) {
+            this->_check_position(pos, "erase_after");
+
+            if (pos.node->next == nullptr) {
+                throw std::runtime_error("segmentation fault");
+            }
+
+            static_cast<void>(this->_unlink_after(pos.node, pos.node->next->next));
+            return iterator(this, pos.node->next);
+        }
+
+        // Unlinks the elements in (`first`, `last`). Returns `last`
+        iterator erase_after(const_iterator first, const_iterator last) {
+            this->_check_position(first, "erase_after");
+
+            static_cast<void>(this->_unlink_after(first.node, last.node));
+            return iterator(this, last.node);
+        }
+
+        // Moves every element of `other` after `pos` in O(1)
+        void splice_after(const_iterator pos, intrusive_singly_list& other) {
+            this->_check_position(pos, "splice_after");
+
+            if (this == &other) {
+                throw std::invalid_argument("splice_after() error: \"other\" and \"*this\" cannot be from the same instance");
+            }
+
+            if (other.empty()) {
+                return;
+            }
+
+            const size_type count = other.sz;
+            _Hook* first = other.head->next;
+            _Hook* last = other.tail;
+
+            other.clear();
+            this->_link_after(pos.node, first, last, count);
+        }
+
+        void splice_after(const_iterator pos, intrusive_singly_list&& other) { this->splice_after(pos, other); }
+
+        // Moves the element after `it` in `other` (which may be `*this`) after `pos`
+        void splice_after(const_iterator pos, intrusive_singly_list& other, const_iterator it) {
+            this->_check_position(pos, "splice_after");
+            other._check_position(it, "splice_after");
+
+            // Splicing an element after itself or after its own predecessor leaves the list unchanged
+            if (it.node->next == nullptr || pos.node == it.node || pos.node == it.node->next) {
+                return;
+            }
+
+            auto [chain, count] = other._unlink_after(it.node, it.node->next->next);
+            this->_link_after(pos.node, chain.first, chain.second, count);
+        }
+
+        void splice_after(const_iterator pos, intrusive_singly_list&& other, const_iterator it) {
+            this->splice_after(pos, other, it);
+        }
+
+        // Moves the elements in (`first`, `last`) of `other` (which may be `*this`, as long as `pos` is not one of
+        // them) after `pos`. Takes time linear in the number of elements moved, to keep both sizes up to date
+        void splice_after(const_iterator pos, intrusive_singly_list& other, const_iterator first, const_iterator last) {
+            this->_check_position(pos, "splice_after");
+            other._check_position(first, "splice_after");
+
+            if (first.node->next == last.node) {
+                return;
+            }
+
+            auto [chain, count] = other._unlink_after(first.node, last.node);
+            this->_link_after(pos.node, chain.first, chain.second, count);
+        }
+
+        void splice_after(const_iterator pos, intrusive_singly_list&& other, const_iterator first,
+                          const_iterator last) {
+            this->splice_after(pos, other, first, last);
+        }
+
+        // Unlinks every element equal to `value`. Returns the number of elements unlinked
+        size_type remove(const_reference value) noexcept {
+            return this->remove_if([&](const_reference element) -> bool { return element == value; });
+        }
+
+        // Unlinks every element for which `pred` returns true. Returns the number of elements unlinked
+        template<class Predicate>
+        size_type remove_if(Predicate pred) noexcept requires (std::predicate<Predicate&, const_reference>) {
+            _Hook* prev = this->head;
+            size_type removed = 0;
+
+            while (prev->next != nullptr) {
+                if (pred(std::as_const(_value(prev->next)))) {
+                    prev->next = prev->next->next;
+                    removed++;
+                } else {
+                    prev = prev->next;
+                }
+            }
+
+            this->tail = prev;
+            this->sz -= removed;
+
+            return removed;
+        }
+
+        constexpr void reverse() noexcept {
+            _Hook* prev = nullptr,
+                 * curr = this->head->next,
+                 * next;
+
+            // The old front becomes the new tail
+            if (curr != nullptr) {
+                this->tail = curr;
+            }
+
+            while (curr != nullptr) {
+                next = curr->next;
+                curr->next = prev;
+                prev = curr;
+                curr = next;
+            }
+
+            this->head->next = prev;
+        }
+
+        // Stable merge sort that only relinks the elements
+        constexpr void sort() noexcept { this->sort(std::less<value_type>{}); }
+
+        template<class Compare>
+        constexpr void sort(Compare comp) noexcept {
+            this->head->next = _merge_sort(this->head->next, comp);
+
+            // Find the new tail of the sorted list
+            while (this->tail->next != nullptr) {
+                this->tail = this->tail->next;
+            }
+        }
+
+        constexpr void swap(intrusive_singly_list& other) noexcept {
+            std::swap(this->head->next, other.head->next);
+
+            // Swap the tails, re-pointing an empty list's tail to its own head
+            _Hook* temp = this->tail;
+            this->tail = (other.tail == other.head) ? this->head : other.tail;
+            other.tail = (temp == this->head) ? other.head : temp;
+
+            std::swap(this->sz, other.sz);
+        }
+
+    };
+
+    /* ----------------------------------------Non-Member Functions------------------------------------------------- */
+    template<class T, class Tag>
+    constexpr void swap(intrusive_singly_list<T, Tag>& lhs, intrusive_singly_list<T, Tag>& rhs) noexcept {
+        lhs.swap(rhs);
+    }
+
+} // adt
+
+
+#endif // INTRUSIVE_SINGLY_LIST_HPP
@@ -0,0 +1,87 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+#include <random>
+#include <forward_list> // baseline to compare against
+
+#include "singly_list.hpp"
+#include "intrusive_singly_list.hpp"
+
+
+/* -------------------------------------------Definitions---------------------------------------------------- */
+// An element that already lives elsewhere (here, in a pool) and only needs to be linked
+struct pooled : adt::intrusive_singly_list_hook<> {
+	int value = 0;
+
+	pooled() = default;
+
+	pooled(int value) : value(value) {}
+
+	bool operator<(const pooled& rhs) const noexcept { return this->value < rhs.value; }
+};
+
+static std::vector<pooled> make_pool(std::size_t n) {
+	std::mt19937 generator(42);
+	std::vector<pooled> pool;
+
+	pool.reserve(n);
+	for (std::size_t i = 0; i < n; i++) {
+		pool.emplace_back(static_cast<int>(generator()));
+	}
+
+	return pool;
+}
+
+/* --------------------------------------------Link Benchmarks----------------------------------------------- */
+// Links every element of the pool, walks the list and unlinks it again. Owning lists allocate and copy each element
+template<class Container>
+static void bench_link(benchmark::State& state) {
+	const std::size_t n = static_cast<std::size_t>(state.range(0));
+	std::vector<pooled> pool = make_pool(n);
+
+	for (auto _ : state) {
+		Container container;
+
+		for (pooled& element : pool) {
+			container.push_front(element);
+		}
+
+		std::int64_t sum = 0;
+		for (const pooled& element : container) {
+			sum += element.value;
+		}
+		benchmark::DoNotOptimize(sum);
+	}
+
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(bench_link<adt::singly_list<pooled>>)->Name("link<adt::singly_list>")->Arg(16)->Arg(1'000)->Arg(100'000);
+BENCHMARK(bench_link<std::forward_list<pooled>>)->Name("link<std::forward_list>")->Arg(16)->Arg(1'000)->Arg(100'000);
+BENCHMARK(bench_link<adt::intrusive_singly_list<pooled>>)->Name("link<adt::intrusive_singly_list>")
+	->Arg(16)->Arg(1'000)->Arg(100'000);
+
+/* --------------------------------------------Sort Benchmarks----------------------------------------------- */
+template<class Container>
+static void bench_sort(benchmark::State& state) {
+	const std::size_t n = static_cast<std::size_t>(state.range(0));
+	std::vector<pooled> pool = make_pool(n);
+	Container container;
+
+	for (auto _ : state) {
+		state.PauseTiming();
+		container.clear();
+		for (pooled& element : pool) {
+			container.push_front(element);
+		}
+		state.ResumeTiming();
+
+		container.sort();
+		benchmark::DoNotOptimize(container.front());
+	}
+
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(bench_sort<adt::singly_list<pooled>>)->Name("sort<adt::singly_list>")->Arg(1'000)->Arg(100'000);
+BENCHMARK(bench_sort<adt::intrusive_singly_list<pooled>>)->Name("sort<adt::intrusive_singly_list>")
+	->Arg(1'000)->Arg(100'000);
@@ -0,0 +1,360 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+#include <algorithm>
+
+#include "intrusive_singly_list.hpp"
+
+
+/* -------------------------------------------Definitions---------------------------------------------------- */
+struct by_id_tag {};
+
+struct by_priority_tag {};
+
+// An object that can be linked in a list by id and in a list by priority at the same time
+struct task : adt::intrusive_singly_list_hook<by_id_tag>, adt::intrusive_singly_list_hook<by_priority_tag> {
+	int id = 0;
+
+	int priority = 0;
+
+	task() = default;
+
+	task(int id, int priority = 0) : id(id), priority(priority) {}
+
+	bool operator==(const task& rhs) const noexcept { return this->id == rhs.id; }
+
+	bool operator<(const task& rhs) const noexcept { return this->id < rhs.id; }
+};
+
+using list_type = adt::intrusive_singly_list<task, by_id_tag>;
+
+using priority_list_type = adt::intrusive_singly_list<task, by_priority_tag>;
+
+// The ids of the elements of `list`, in order
+template<class List>
+static std::vector<int> ids(const List& list) {
+	std::vector<int> result;
+	for (const task& element : list) {
+		result.push_back(element.id);
+	}
+	return result;
+}
+
+/* ---------------------------------Intrusive Singly List Constructors Tests--------------------------------- */
+TEST(intrusive_singly_list__constructors, default_constructor) {
+	list_type list;
+
+	EXPECT_TRUE(list.empty());
+	EXPECT_EQ(list.size(), 0);
+	EXPECT_EQ(list.begin(), list.end());
+	EXPECT_THROW(static_cast<void>(list.front()), std::runtime_error);
+	EXPECT_THROW(static_cast<void>(list.back()), std::runtime_error);
+}
+
+TEST(intrusive_singly_list__constructors, range_constructor) {
+	std::vector<task> tasks = {1, 2, 3};
+	list_type list(tasks.begin(), tasks.end());
+
+	EXPECT_EQ(ids(list), std::vector<int>({1, 2, 3}));
+	EXPECT_EQ(list.size(), 3);
+	EXPECT_EQ(&list.front(), &tasks[0]);
+	EXPECT_EQ(&list.back(), &tasks[2]);
+}
+
+TEST(intrusive_singly_list__constructors, move_constructor) {
+	std::vector<task> tasks = {1, 2, 3};
+	list_type list(tasks.begin(), tasks.end()),
+			  list_move(std::move(list));
+
+	EXPECT_EQ(ids(list_move), std::vector<int>({1, 2, 3}));
+	EXPECT_TRUE(list.empty());
+
+	// Both lists keep working on their own dummy node
+	task four(4),
+		 five(5);
+	list.push_back(four);
+	list_move.push_back(five);
+	EXPECT_EQ(ids(list), std::vector<int>({4}));
+	EXPECT_EQ(ids(list_move), std::vector<int>({1, 2, 3, 5}));
+}
+
+TEST(intrusive_singly_list__constructors, copy__does_not_copy_links) {
+	task original(1),
+		 follower(2);
+	list_type list;
+
+	list.push_back(original);
+	list.push_back(follower);
+
+	task copy(original);
+	original = follower;
+
+	EXPECT_EQ(ids(list), std::vector<int>({2, 2}));
+	EXPECT_EQ(list.size(), 2);
+
+	list_type other;
+	other.push_back(copy);
+	EXPECT_EQ(ids(other), std::vector<int>({1}));
+}
+
+/* ----------------------------------Intrusive Singly List Operators Tests----------------------------------- */
+TEST(intrusive_singly_list__operators, move_assignment) {
+	std::vector<task> tasks = {1, 2, 3, 4};
+	list_type list(tasks.begin(), tasks.begin() + 2),
+			  other(tasks.begin() + 2, tasks.end());
+
+	other = std::move(list);
+
+	EXPECT_EQ(ids(other), std::vector<int>({1, 2}));
+	EXPECT_TRUE(list.empty());
+
+	other.push_back(tasks[3]);
+	EXPECT_EQ(ids(other), std::vector<int>({1, 2, 4}));
+}
+
+/* -----------------------------------Intrusive Singly List Methods Tests------------------------------------ */
+TEST(intrusive_singly_list__methods, push_pop) {
+	task a(1),
+		 b(2),
+		 c(3);
+	list_type list;
+
+	list.push_back(b);
+	list.push_front(a);
+	list.push_back(c);
+	EXPECT_EQ(ids(list), std::vector<int>({1, 2, 3}));
+
+	list.pop_front();
+	EXPECT_EQ(ids(list), std::vector<int>({2, 3}));
+	EXPECT_EQ(&list.front(), &b);
+
+	list.pop_front();
+	list.pop_front();
+	EXPECT_TRUE(list.empty());
+	EXPECT_THROW(list.pop_front(), std::runtime_error);
+
+	// The tail is back on the dummy node
+	list.push_back(a);
+	EXPECT_EQ(&list.back(), &a);
+}
+
+TEST(intrusive_singly_list__methods, insert_after) {
+	std::vector<task> tasks = {1, 3, 5};
+	task two(2),
+		 four(4);
+	list_type list(tasks.begin(), tasks.end());
+
+	auto it = list.insert_after(list.begin(), two);
+	EXPECT_EQ(&*it, &two);
+
+	list.insert_after(std::next(list.begin(), 2), four);
+	EXPECT_EQ(ids(list), std::vector<int>({1, 2, 3, 4, 5}));
+	EXPECT_EQ(list.size(), 5);
+}
+
+TEST(intrusive_singly_list__methods, insert_after__range) {
+	std::vector<task> tasks = {1, 4},
+					  middle = {2, 3};
+	list_type list(tasks.begin(), tasks.end());
+
+	auto it = list.insert_after(list.begin(), middle.begin(), middle.end());
+
+	EXPECT_EQ(&*it, &middle.back());
+	EXPECT_EQ(ids(list), std::vector<int>({1, 2, 3, 4}));
+
+	list.insert_after(list.before_begin(), middle.end(), middle.end());
+	EXPECT_EQ(list.size(), 4);
+}
+
+TEST(intrusive_singly_list__methods, insert_after__foreign_position) {
+	task a(1);
+	list_type list,
+			  other;
+
+	EXPECT_THROW(list.insert_after(other.before_begin(), a), std::invalid_argument);
+	EXPECT_THROW(list.insert_after(list.end(), a), std::runtime_error);
+}
+
+TEST(intrusive_singly_list__methods, erase_after) {
+	std::vector<task> tasks = {1, 2, 3, 4, 5};
+	list_type list(tasks.begin(), tasks.end());
+
+	auto it = list.erase_after(list.begin());
+	EXPECT_EQ(it->id, 3);
+	EXPECT_EQ(ids(list), std::vector<int>({1, 3, 4, 5}));
+
+	it = list.erase_after(std::next(list.begin(), 2));
+	EXPECT_EQ(it, list.end());
+	EXPECT_EQ(&list.back(), &tasks[3]);
+
+	EXPECT_THROW(list.erase_after(std::next(list.begin(), 2)), std::runtime_error);
+}
+
+TEST(intrusive_singly_list__methods, erase_after__range) {
+	std::vector<task> tasks = {1, 2, 3, 4, 5};
+	list_type list(tasks.begin(), tasks.end());
+
+	list.erase_after(list.begin(), std::next(list.begin(), 3));
+	EXPECT_EQ(ids(list), std::vector<int>({1, 4, 5}));
+
+	list.erase_after(list.begin(), list.end());
+	EXPECT_EQ(ids(list), std::vector<int>({1}));
+	EXPECT_EQ(&list.back(), &tasks[0]);
+	EXPECT_EQ(list.size(), 1);
+}
+
+TEST(intrusive_singly_list__methods, clear) {
+	std::vector<task> tasks = {1, 2, 3};
+	list_type list(tasks.begin(), tasks.end());
+
+	list.clear();
+	EXPECT_TRUE(list.empty());
+	EXPECT_EQ(list.begin(), list.end());
+
+	// Cleared elements can be linked again
+	list.push_back(tasks[2]);
+	list.push_back(tasks[0]);
+	EXPECT_EQ(ids(list), std::vector<int>({3, 1}));
+}
+
+TEST(intrusive_singly_list__methods, splice_after__whole_list) {
+	std::vector<task> tasks = {1, 4, 2, 3};
+	list_type list(tasks.begin(), tasks.begin() + 2),
+			  other(tasks.begin() + 2, tasks.end());
+
+	list.splice_after(list.begin(), other);
+
+	EXPECT_EQ(ids(list), std::vector<int>({1, 2, 3, 4}));
+	EXPECT_EQ(list.size(), 4);
+	EXPECT_TRUE(other.empty());
+
+	task five(5);
+	other.push_back(five);
+	EXPECT_EQ(ids(other), std::vector<int>({5}));
+
+	EXPECT_THROW(list.splice_after(list.begin(), list), std::invalid_argument);
+}
+
+TEST(intrusive_singly_list__methods, splice_after__single_element) {
+	std::vector<task> tasks = {1, 2, 3},
+					  others = {4, 5};
+	list_type list(tasks.begin(), tasks.end()),
+			  other(others.begin(), others.end());
+
+	list.splice_after(std::next(list.begin(), 2), other, other.begin());
+	EXPECT_EQ(ids(list), std::vector<int>({1, 2, 3, 5}));
+	EXPECT_EQ(ids(other), std::vector<int>({4}));
+	EXPECT_EQ(&list.back(), &others[1]);
+	EXPECT_EQ(&other.back(), &others[0]);
+
+	// Within the same list
+	list.splice_after(std::next(list.begin(), 3), list, list.before_begin());
+	EXPECT_EQ(ids(list), std::vector<int>({2, 3, 5, 1}));
+	EXPECT_EQ(&list.back(), &tasks[0]);
+
+	list.splice_after(list.begin(), list, list.before_begin());
+	EXPECT_EQ(ids(list), std::vector<int>({2, 3, 5, 1}));
+}
+
+TEST(intrusive_singly_list__methods, splice_after__range) {
+	std::vector<task> tasks = {1, 5},
+					  others = {0, 2, 3, 4, 6};
+	list_type list(tasks.begin(), tasks.end()),
+			  other(others.begin(), others.end());
+
+	list.splice_after(list.begin(), other, other.begin(), std::next(other.begin(), 4));
+
+	EXPECT_EQ(ids(list), std::vector<int>({1, 2, 3, 4, 5}));
+	EXPECT_EQ(ids(other), std::vector<int>({0, 6}));
+	EXPECT_EQ(list.size(), 5);
+	EXPECT_EQ(other.size(), 2);
+
+	list.splice_after(std::next(list.begin(), 4), other, other.before_begin(), other.end());
+	EXPECT_EQ(ids(list), std::vector<int>({1, 2, 3, 4, 5, 0, 6}));
+	EXPECT_EQ(&list.back(), &others[4]);
+	EXPECT_TRUE(other.empty());
+}
+
+TEST(intrusive_singly_list__methods, remove_if) {
+	std::vector<task> tasks = {1, 2, 3, 4, 5, 6};
+	list_type list(tasks.begin(), tasks.end());
+
+	EXPECT_EQ(list.remove_if([](const task& element) { return element.id % 2 == 0; }), 3);
+	EXPECT_EQ(ids(list), std::vector<int>({1, 3, 5}));
+	EXPECT_EQ(list.size(), 3);
+	EXPECT_EQ(&list.back(), &tasks[4]);
+
+	EXPECT_EQ(list.remove(task(5)), 1);
+	EXPECT_EQ(&list.back(), &tasks[2]);
+	EXPECT_EQ(list.remove(task(7)), 0);
+}
+
+TEST(intrusive_singly_list__methods, reverse) {
+	std::vector<task> tasks = {1, 2, 3, 4};
+	list_type list(tasks.begin(), tasks.end());
+
+	list.reverse();
+
+	EXPECT_EQ(ids(list), std::vector<int>({4, 3, 2, 1}));
+	EXPECT_EQ(&list.back(), &tasks[0]);
+
+	list.push_back(tasks[3]);
+	EXPECT_EQ(list.size(), 5);
+}
+
+TEST(intrusive_singly_list__methods, sort) {
+	std::vector<task> tasks = {{5, 0}, {3, 1}, {6, 0}, {1, 1}, {4, 0}, {2, 1}};
+	list_type list(tasks.begin(), tasks.end());
+
+	list.sort();
+	EXPECT_EQ(ids(list), std::vector<int>({1, 2, 3, 4, 5, 6}));
+	EXPECT_EQ(&list.back(), &tasks[2]);
+
+	// Stable: equal priorities keep their relative order
+	list.sort([](const task& lhs, const task& rhs) { return lhs.priority < rhs.priority; });
+	EXPECT_EQ(ids(list), std::vector<int>({4, 5, 6, 1, 2, 3}));
+	EXPECT_EQ(&list.back(), &tasks[1]);
+}
+
+TEST(intrusive_singly_list__methods, swap) {
+	std::vector<task> tasks = {1, 2, 3};
+	list_type list(tasks.begin(), tasks.end()),
+			  other;
+
+	swap(list, other);
+	EXPECT_TRUE(list.empty());
+	EXPECT_EQ(ids(other), std::vector<int>({1, 2, 3}));
+
+	other.pop_front();
+	list.push_back(tasks[0]);
+	EXPECT_EQ(ids(list), std::vector<int>({1}));
+	EXPECT_EQ(ids(other), std::vector<int>({2, 3}));
+}
+
+TEST(intrusive_singly_list__methods, iterator_to) {
+	std::vector<task> tasks = {1, 2, 3};
+	list_type list(tasks.begin(), tasks.end());
+
+	list.erase_after(list.iterator_to(tasks[0]));
+
+	EXPECT_EQ(ids(list), std::vector<int>({1, 3}));
+}
+
+TEST(intrusive_singly_list__methods, multiple_lists) {
+	std::vector<task> tasks = {{1, 3}, {2, 1}, {3, 2}};
+	list_type by_id(tasks.begin(), tasks.end());
+	priority_list_type by_priority(tasks.begin(), tasks.end());
+
+	by_priority.sort([](const task& lhs, const task& rhs) { return lhs.priority < rhs.priority; });
+	by_id.reverse();
+
+	EXPECT_EQ(ids(by_priority), std::vector<int>({2, 3, 1}));
+	EXPECT_EQ(ids(by_id), std::vector<int>({3, 2, 1}));
+
+	// Unlinking from one list leaves the other untouched
+	by_id.remove(tasks[1]);
+	EXPECT_EQ(ids(by_id), std::vector<int>({3, 1}));
+	EXPECT_EQ(ids(by_priority), std::vector<int>({2, 3, 1}));
+	EXPECT_EQ(&by_priority.front(), &tasks[1]);
+}
@@ -0,0 +1,294 @@
+#ifndef MPMC_LIST_QUEUE_HPP
+#define MPMC_LIST_QUEUE_HPP
+
+#include <cstddef>
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <ranges>
+#include <utility>
+
+#include "hazard_pointer.hpp"
+#include "singly_list.hpp"
+
+
+namespace adt {
+
+    // A multi-producer, multi-consumer FIFO queue over singly linked nodes (Michael & Scott). Elements are enqueued
+    // at the back and dequeued at the front without locks; dequeued nodes are reclaimed through hazard pointers. The
+    // front node is a dummy whose successor holds the first element, so producers and consumers only meet on an
+    // almost empty queue. The nodes share singly_list's layout, which requires `T` to be default constructible. The
+    // allocator must be safe to call from several threads at once
+    template<class T, class Allocator = std::allocator<T>>
+    class mpmc_list_queue {
+    public:
+        /* -----------------------------------------------Definitions----------------------------------------------- */
+        using value_type = T;
+
+        using allocator_type = Allocator;
+
+        using size_type = std::size_t;
+
+        using reference = value_type&;
+
+        using const_reference = const value_type&;
+
+    private:
+        /* -----------------------------------------------Definitions----------------------------------------------- */
+        using _Node = typename singly_list<T, Allocator>::_Node;
+
+        using _NodeAllocator = typename singly_list<T, Allocator>::_NodeAllocator;
+
+        using node_allocator_traits = typename std::allocator_traits<_NodeAllocator>;
+
+        // Keeps the producers' tail, the consumers' head and the retired list on cache lines of their own
+        static constexpr std::size_t _cache_line = 64;
+
+        /* ------------------------------------------------Fields--------------------------------------------------- */
+        alignas(_cache_line) std::atomic<_Node*> head;
+
+        alignas(_cache_line) std::atomic<_Node*> tail;
+
+        alignas(_cache_line) hazard_retired_list<_Node> retired;
+
+        allocator_type allocator;
+
+        _NodeAllocator node_allocator;
+
+        /* ------------------------------------------------Methods-------------------------------------------------- */
+        // Links of published nodes may be read and written by several threads at once
+        [[nodiscard]] static _Node* _load_next(_Node* node) noexcept {
+            return std::atomic_ref<_Node*>(node->next).load(std::memory_order_acquire);
+        }
+
+        template<class... Args>
+        _Node* _emplace_node(Args&&... args) {
+            _Node* node = node_allocator_traits::allocate(this->node_allocator, 1);
+            node_allocator_traits::construct(this->node_allocator, node, std::in_place, nullptr,
+                                             std::forward<Args>(args)...);
+            return node;
+        }
+
+        void _destroy_node(_Node* node) noexcept {
+            node_allocator_traits::destroy(this->node_allocator, node);
+            node_allocator_traits::deallocate(this->node_allocator, node, 1);
+        }
+
+        // Links the detached chain `first`..`last` after the last node
+        void _enqueue_chain(_Node* first, _Node* last) {
+            while (true) {
+                _Node* node = hazard_pointers::protect(0, this->tail);
+                _Node* next = _load_next(node);
+
+                if (node != this->tail.load()) {
+                    continue;
+                }
+
+                // The tail lags behind the last node: help the producer that linked it
+                if (next != nullptr) {
+                    this->tail.compare_exchange_weak(node, next);
+                    continue;
+                }
+
+                if (std::atomic_ref<_Node*>(node->next).compare_exchange_weak(next, first)) {
+                    this->tail.compare_exchange_strong(node, last);
+                    break;
+                }
+            }
+
+            hazard_pointers::clear(0);
+        }
+
+        // Dequeues up to `max_count` (> 0) elements with a single update of the head, passing each one to
+        // `consume(value_type&&)` in order. Returns the number of elements dequeued
+        template<class Consume>
+        size_type _dequeue(size_type max_count, Consume consume) {
+            _Node* first;
+            _Node* last;
+            size_type count;
+
+            while (true) {
+                first = hazard_pointers::protect(0, this->head);
+                _Node* snapshot_tail = this->tail.load();
+                last = hazard_pointers::protect(1, std::atomic_ref<_Node*>(first->next));
+
+                if (first != this->head.load()) {
+                    continue;
+                }
+                if (last == nullptr) {
+                    hazard_pointers::clear(0);
+                    hazard_pointers::clear(1);
+                    return 0;
+                }
+
+                // The tail must never fall behind the head, so help the producer that linked `last`
+                if (first == snapshot_tail) {
+                    this->tail.compare_exchange_weak(snapshot_tail, last);
+                    continue;
+                }
+
+                // Extend the batch hand over hand, never past the tail seen above. As long as the head has not moved,
+                // no node after it has been dequeued, so every node published in slot 1 is still alive
+                bool moved = false;
+                count = 1;
+
+                while (count < max_count && last != snapshot_tail) {
+                    _Node* next = _load_next(last);
+                    if (next == nullptr) {
+                        break;
+                    }
+
+                    hazard_pointers::set(1, next);
+                    if (first != this->head.load()) {
+                        moved = true;
+                        break;
+                    }
+
+                    last = next;
+                    count++;
+                }
+
+                _Node* expected = first;
+                if (!moved && this->head.compare_exchange_strong(expected, last)) {
+                    break;
+                }
+            }
+
+            hazard_pointers::clear(0);
+
+            // The nodes between `first` and `last` are now owned by this thread alone; `last` becomes the new dummy
+            // and stays protected until its value has been taken
+            _Node* node = first;
+            bool reclaim = false;
+
+            try {
+                for (size_type i = 0; i < count; i++) {
+                    _Node* next = _load_next(node);
+                    consume(std::move(next->value));
+                    reclaim |= this->retired.retire(node);
+                    node = next;
+                }
+            } catch (...) {
+                // The elements left in the claimed nodes are dropped: retire those nodes and release `last`
+                while (node != last) {
+                    _Node* next = _load_next(node);
+                    static_cast<void>(this->retired.retire(node));
+                    node = next;
+                }
+                hazard_pointers::clear(1);
+                throw;
+            }
+
+            hazard_pointers::clear(1);
+            if (reclaim) {
+                this->retired.reclaim([this](_Node* node) -> void { this->_destroy_node(node); });
+            }
+
+            return count;
+        }
+
+    public:
+        /* ----------------------------------------------Constructors----------------------------------------------- */
+        mpmc_list_queue() : mpmc_list_queue(allocator_type()) {}
+
+        explicit mpmc_list_queue(const allocator_type& allocator)
+            : allocator(allocator), node_allocator(allocator) {
+            _Node* dummy = node_allocator_traits::allocate(this->node_allocator, 1);
+            node_allocator_traits::construct(this->node_allocator, dummy);
+
+            this->head.store(dummy, std::memory_order_relaxed);
+            this->tail.store(dummy, std::memory_order_relaxed);
+        }
+
+        mpmc_list_queue(const mpmc_list_queue&) = delete;
+
+        mpmc_list_queue(mpmc_list_queue&&) = delete;
+
+        /* -----------------------------------------------Destructor------------------------------------------------ */
+        // No other thread may access the queue anymore
+        ~mpmc_list_queue() noexcept {
+            _Node* node = this->head.load(std::memory_order_acquire);
+            while (node != nullptr) {
+                _Node* next = node->next;
+                this->_destroy_node(node);
+                node = next;
+            }
+
+            this->retired.clear([this](_Node* node) -> void { this->_destroy_node(node); });
+        }
+
+        /* ------------------------------------------Overloaded Operators------------------------------------------- */
+        mpmc_list_queue& operator=(const mpmc_list_queue&) = delete;
+
+        mpmc_list_queue& operator=(mpmc_list_queue&&) = delete;
+
+        /* ------------------------------------------------Methods-------------------------------------------------- */
+        [[nodiscard]] allocator_type get_allocator() const noexcept { return this->allocator; }
+
+        // A snapshot: other threads may enqueue or dequeue right after it is taken
+        [[nodiscard]] bool empty() const {
+            _Node* node = hazard_pointers::protect(0, this->head);
+            const bool is_empty = _load_next(node) == nullptr;
+            hazard_pointers::clear(0);
+
+            return is_empty;
+        }
+
+        void push_back(const_reference value) { this->emplace_back(value); }
+
+        void push_back(value_type&& value) { this->emplace_back(std::move(value)); }
+
+        template<class... Args>
+        void emplace_back(Args&&... args) {
+            _Node* node = this->_emplace_node(std::forward<Args>(args)...);
+            this->_enqueue_chain(node, node);
+        }
+
+        // Enqueues every element of `range` at once: they are linked together first, then published with a single
+        // update, so they are dequeued contiguously
+        template<std::ranges::input_range R>
+        void append_range(R&& range) {
+            _Node* first = nullptr,
+                 * last = nullptr;
+
+            for (auto&& value : range) {
+                _Node* node = this->_emplace_node(std::forward<decltype(value)>(value));
+
+                if (last == nullptr) {
+                    first = node;
+                } else {
+                    last->next = node;
+                }
+                last = node;
+            }
+
+            if (first != nullptr) {
+                this->_enqueue_chain(first, last);
+            }
+        }
+
+        // Removes the front element and returns it, or returns nothing if the queue is empty
+        std::optional<value_type> pop_front() {
+            std::optional<value_type> value;
+            this->_dequeue(1, [&](value_type&& front) -> void { value.emplace(std::move(front)); });
+
+            return value;
+        }
+
+        // Removes up to `count` elements from the front with a single update of the head, writing them to `out` in
+        // order. Returns the number of elements removed
+        template<class OutputIt>
+        size_type pop_front(OutputIt out, size_type count) {
+            if (count == 0) {
+                return 0;
+            }
+
+            return this->_dequeue(count, [&](value_type&& front) -> void { *out++ = std::move(front); });
+        }
+
+    };
+
+} // adt
+
+
+#endif // MPMC_LIST_QUEUE_HPP
@@ -0,0 +1,146 @@
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "mpmc_list_queue.hpp"
+#include "singly_list.hpp"
+
+
+/* -------------------------------------------Definitions---------------------------------------------------- */
+// Every element is the time at which it was enqueued, in nanoseconds
+using value_type = std::uint64_t;
+
+// Baseline: a singly_list used as a FIFO behind a mutex
+class locked_list_queue {
+private:
+	std::mutex mutex;
+
+	adt::singly_list<value_type> list;
+
+public:
+	void push_back(value_type value) {
+		std::lock_guard<std::mutex> lock(this->mutex);
+		this->list.push_back(value);
+	}
+
+	std::optional<value_type> pop_front() {
+		std::lock_guard<std::mutex> lock(this->mutex);
+		if (this->list.empty()) {
+			return std::nullopt;
+		}
+
+		value_type value = this->list.front();
+		this->list.pop_front();
+		return value;
+	}
+};
+
+/* ---------------------------------------------Helpers------------------------------------------------------ */
+static value_type now_ns() {
+	return static_cast<value_type>(
+		std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()
+		).count()
+	);
+}
+
+// Latency histogram with power-of-two buckets: bucket `i` counts latencies in [2^(i-1), 2^i) ns
+class latency_histogram {
+private:
+	std::array<std::uint64_t, 64> buckets = {};
+
+	std::uint64_t count = 0;
+
+public:
+	void record(value_type latency_ns) {
+		this->buckets[std::bit_width(latency_ns)]++;
+		this->count++;
+	}
+
+	// Upper bound of the bucket holding the `fraction` quantile, in ns
+	[[nodiscard]] double quantile(double fraction) const {
+		const std::uint64_t target = static_cast<std::uint64_t>(fraction * static_cast<double>(this->count));
+		std::uint64_t seen = 0;
+
+		for (std::size_t i = 0; i < this->buckets.size(); i++) {
+			seen += this->buckets[i];
+			if (seen > target) {
+				return static_cast<double>(std::uint64_t(1) << i);
+			}
+		}
+
+		return 0.0;
+	}
+};
+
+/* ----------------------------------------Producer/Consumer Benchmarks-------------------------------------- */
+// The first half of the threads produce and the second half consume; each consumer records the time every
+// element spent in the queue. The latency counters are the consumers' average of the bucket bounds of each quantile
+template<class Queue>
+static void bench_producer_consumer(benchmark::State& state) {
+	static Queue queue;
+	const bool is_producer = state.thread_index() < state.threads() / 2;
+	latency_histogram histogram;
+
+	for (auto _ : state) {
+		if (is_producer) {
+			queue.push_back(now_ns());
+			continue;
+		}
+
+		std::optional<value_type> value;
+		while (!(value = queue.pop_front())) {
+			std::this_thread::yield();
+		}
+		histogram.record(now_ns() - *value);
+	}
+
+	if (!is_producer) {
+		// Counters are averaged over every thread, half of which are producers reporting nothing
+		state.counters["p50_ns"] = benchmark::Counter(2 * histogram.quantile(0.5), benchmark::Counter::kAvgThreads);
+		state.counters["p99_ns"] = benchmark::Counter(2 * histogram.quantile(0.99), benchmark::Counter::kAvgThreads);
+		state.counters["p999_ns"] = benchmark::Counter(2 * histogram.quantile(0.999), benchmark::Counter::kAvgThreads);
+		state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+	}
+}
+BENCHMARK(bench_producer_consumer<adt::mpmc_list_queue<value_type>>)->Name("producer_consumer<adt::mpmc_list_queue>")
+	->Threads(2)->Threads(8)->Threads(32)->UseRealTime();
+BENCHMARK(bench_producer_consumer<locked_list_queue>)->Name("producer_consumer<mutex + adt::singly_list>")
+	->Threads(2)->Threads(8)->Threads(32)->UseRealTime();
+
+/* ------------------------------------------Batch Benchmarks------------------------------------------------ */
+// Same split, moving 64 elements per enqueue and per dequeue
+static void bench_producer_consumer__batch(benchmark::State& state) {
+	static adt::mpmc_list_queue<value_type> queue;
+	constexpr std::size_t batch = 64;
+	const bool is_producer = state.thread_index() < state.threads() / 2;
+	std::vector<value_type> values(batch);
+
+	for (auto _ : state) {
+		if (is_producer) {
+			queue.append_range(values);
+			continue;
+		}
+
+		for (std::size_t popped = 0; popped < batch; ) {
+			const std::size_t count = queue.pop_front(values.begin(), batch - popped);
+			if (count == 0) {
+				std::this_thread::yield();
+			}
+			popped += count;
+		}
+	}
+
+	if (!is_producer) {
+		state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * batch);
+	}
+}
+BENCHMARK(bench_producer_consumer__batch)->Name("producer_consumer__batch<adt::mpmc_list_queue>")
+	->Threads(2)->Threads(8)->Threads(32)->UseRealTime();
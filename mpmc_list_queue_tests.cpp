@@ -0,0 +1,210 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <memory> // to test move-only elements
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <iterator>
+
+#include "mpmc_list_queue.hpp"
+
+
+/* -------------------------------------------Definitions---------------------------------------------------- */
+using queue_type = adt::mpmc_list_queue<int>;
+
+namespace {
+
+	// Counts the instances alive, to check that every element is destroyed
+	struct tracked {
+		static inline int alive = 0;
+
+		tracked() { alive++; }
+
+		tracked(const tracked&) { alive++; }
+
+		~tracked() { alive--; }
+	};
+
+	// An output iterator whose assignment throws once `remaining` elements have been written
+	struct failing_output {
+		int remaining;
+
+		failing_output& operator*() { return *this; }
+
+		failing_output& operator++(int) { return *this; }
+
+		failing_output& operator=(tracked&&) {
+			if (this->remaining-- == 0) {
+				throw std::runtime_error("failing_output error: write failed");
+			}
+			return *this;
+		}
+	};
+
+} // namespace
+
+// Pushes `per_producer` elements from each producer while the consumers pop, popping `batch` elements at a time, and
+// checks that every element comes out exactly once and in the order its producer pushed it
+static void check_producers_consumers(int producer_count, int consumer_count, int per_producer, std::size_t batch) {
+	queue_type queue;
+	std::atomic<int> popped_count = 0;
+	std::atomic<long long> popped_sum = 0;
+	std::atomic<bool> ordered = true;
+	std::vector<std::thread> threads;
+	const int total = producer_count * per_producer;
+
+	for (int p = 0; p < producer_count; p++) {
+		threads.emplace_back([&, p]() {
+			for (int i = 0; i < per_producer; i += static_cast<int>(batch)) {
+				std::vector<int> values;
+				for (int j = i; j < per_producer && j < i + static_cast<int>(batch); j++) {
+					values.push_back(p * per_producer + j);
+				}
+
+				if (batch == 1) {
+					queue.push_back(values.front());
+				} else {
+					queue.append_range(values);
+				}
+			}
+		});
+	}
+
+	for (int c = 0; c < consumer_count; c++) {
+		threads.emplace_back([&]() {
+			std::vector<int> last_seen(producer_count, -1),
+							 values;
+
+			while (popped_count < total) {
+				values.clear();
+				const int count = static_cast<int>(queue.pop_front(std::back_inserter(values), batch));
+
+				for (int value : values) {
+					int& last = last_seen[value / per_producer];
+					if (value <= last) {
+						ordered = false;
+					}
+					last = value;
+					popped_sum += value;
+				}
+				popped_count += count;
+			}
+		});
+	}
+
+	for (std::thread& thread : threads) {
+		thread.join();
+	}
+
+	EXPECT_EQ(popped_count, total);
+	EXPECT_EQ(popped_sum, static_cast<long long>(total) * (total - 1) / 2);
+	EXPECT_TRUE(ordered);
+	EXPECT_TRUE(queue.empty());
+}
+
+/* ---------------------------------MPMC List Queue Single-Threaded Tests------------------------------------ */
+TEST(mpmc_list_queue__methods, default_constructor) {
+	queue_type queue;
+	std::vector<int> values;
+
+	EXPECT_TRUE(queue.empty());
+	EXPECT_EQ(queue.pop_front(), std::nullopt);
+	EXPECT_EQ(queue.pop_front(std::back_inserter(values), 4), 0);
+	EXPECT_TRUE(values.empty());
+}
+
+TEST(mpmc_list_queue__methods, push_back__pop_front) {
+	queue_type queue;
+
+	for (int i = 0; i < 200; i++) {
+		queue.push_back(i);
+	}
+	EXPECT_FALSE(queue.empty());
+
+	// Enough pops to go through several reclamation passes
+	for (int i = 0; i < 200; i++) {
+		EXPECT_EQ(queue.pop_front(), i);
+	}
+
+	EXPECT_TRUE(queue.empty());
+	EXPECT_EQ(queue.pop_front(), std::nullopt);
+
+	queue.push_back(1);
+	EXPECT_EQ(queue.pop_front(), 1);
+}
+
+TEST(mpmc_list_queue__methods, append_range__pop_front__batch) {
+	queue_type queue;
+	std::vector<int> values,
+					 first_matcher = {1, 2, 3, 4},
+					 second_matcher = {5, 6, 7, 8, 9, 10, 11};
+
+	queue.append_range(std::vector<int>{1, 2, 3, 4, 5, 6, 7, 8, 9, 10});
+	queue.push_back(11);
+
+	EXPECT_EQ(queue.pop_front(std::back_inserter(values), 4), 4);
+	EXPECT_EQ(values, first_matcher);
+
+	// Asking for more than the queue holds takes what is there
+	values.clear();
+	EXPECT_EQ(queue.pop_front(std::back_inserter(values), 100), 7);
+	EXPECT_EQ(values, second_matcher);
+	EXPECT_TRUE(queue.empty());
+}
+
+TEST(mpmc_list_queue__methods, emplace_back__move_only) {
+	adt::mpmc_list_queue<std::unique_ptr<int>> queue;
+
+	queue.emplace_back(std::make_unique<int>(1));
+	queue.push_back(std::make_unique<int>(2));
+
+	std::optional<std::unique_ptr<int>> value = queue.pop_front();
+	ASSERT_TRUE(value.has_value());
+	EXPECT_EQ(**value, 1);
+}
+
+TEST(mpmc_list_queue__methods, destructor__releases_elements) {
+	{
+		adt::mpmc_list_queue<tracked> queue;
+		for (int i = 0; i < 10; i++) {
+			queue.emplace_back();
+		}
+		static_cast<void>(queue.pop_front());
+	}
+
+	EXPECT_EQ(tracked::alive, 0);
+}
+
+TEST(mpmc_list_queue__methods, pop_front__batch__throwing_output) {
+	{
+		adt::mpmc_list_queue<tracked> queue;
+		for (int i = 0; i < 5; i++) {
+			queue.emplace_back();
+		}
+
+		// The batch of 3 is claimed, then the second write throws
+		EXPECT_THROW(queue.pop_front(failing_output{1}, 3), std::runtime_error);
+		EXPECT_TRUE(adt::hazard_pointers::snapshot().empty());
+
+		// The rest of the batch was dropped, and the elements after it are still queued
+		EXPECT_TRUE(queue.pop_front().has_value());
+		EXPECT_TRUE(queue.pop_front().has_value());
+		EXPECT_FALSE(queue.pop_front().has_value());
+	}
+
+	EXPECT_EQ(tracked::alive, 0);
+}
+
+/* ----------------------------------MPMC List Queue Multi-Threaded Tests------------------------------------ */
+TEST(mpmc_list_queue__threads, single_producer_single_consumer) {
+	check_producers_consumers(1, 1, 50'000, 1);
+}
+
+TEST(mpmc_list_queue__threads, multiple_producers_multiple_consumers) {
+	check_producers_consumers(4, 4, 20'000, 1);
+}
+
+TEST(mpmc_list_queue__threads, multiple_producers_multiple_consumers__batch) {
+	check_producers_consumers(4, 4, 20'000, 16);
+}
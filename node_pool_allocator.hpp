@@ -0,0 +1,309 @@
+#ifndef NODE_POOL_ALLOCATOR_HPP
+#define NODE_POOL_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+
+
+namespace adt {
+
+    template<std::size_t SlotSize, std::size_t SlotAlign, std::size_t BlockSize>
+    class _node_pool {
+    private:
+        /* ------------------------------------------------Slot----------------------------------------------------- */
+        union _Slot {
+            /* --------------------------------------------Fields--------------------------------------------------- */
+            _Slot* next;
+
+            alignas(SlotAlign) std::byte storage[SlotSize];
+
+        };
+
+        /* ----------------------------------------------Definitions------------------------------------------------ */
+        static constexpr std::size_t slot_align = alignof(_Slot);
+
+        // Blocks are never freed (see instance()), so they are not tracked and every slot of a block is handed out
+        static constexpr std::size_t slots_per_block = (BlockSize / sizeof(_Slot) > 1) ? BlockSize / sizeof(_Slot) : 1;
+
+        // Number of slots a thread-local cache moves to or from the pool at once
+        static constexpr std::size_t batch_size = (slots_per_block / 2 > 1) ? slots_per_block / 2 : 1;
+
+        /* -----------------------------------------Thread-Local Cache---------------------------------------------- */
+        struct _Cache {
+            /* --------------------------------------------Fields--------------------------------------------------- */
+            _Slot* free_list = nullptr;
+
+            std::size_t count = 0;
+
+            /* -------------------------------------------Destructor------------------------------------------------ */
+            ~_Cache() noexcept {
+                // Give every cached slot back to the pool when the thread exits
+                if (this->free_list != nullptr) {
+                    _node_pool::instance()._release_chain(this->free_list, this->count);
+                }
+            }
+
+        };
+
+        /* ------------------------------------------------Fields--------------------------------------------------- */
+        std::mutex mutex;
+
+        _Slot* free_list;
+
+        _Slot* bump;
+
+        _Slot* bump_end;
+
+        /* ----------------------------------------------Constructors----------------------------------------------- */
+        constexpr _node_pool() noexcept
+            : free_list(nullptr), bump(nullptr), bump_end(nullptr) {}
+
+        /* ------------------------------------------------Methods-------------------------------------------------- */
+        static _Cache& _cache() noexcept {
+            thread_local _Cache cache;
+            return cache;
+        }
+
+        // Must be called with `mutex` held
+        _Slot* _take_slot() {
+            // Recycle a freed slot first
+            if (this->free_list != nullptr) {
+                _Slot* slot = this->free_list;
+                this->free_list = slot->next;
+                return slot;
+            }
+
+            // Otherwise, carve the next slot out of the current block, allocating a new block if it is exhausted
+            if (this->bump == this->bump_end) {
+                _Slot* block = static_cast<_Slot*>(
+                    ::operator new(slots_per_block * sizeof(_Slot), std::align_val_t(slot_align))
+                );
+
+                this->bump = block;
+                this->bump_end = block + slots_per_block;
+            }
+
+            return this->bump++;
+        }
+
+        void _release_chain(_Slot* first, std::size_t count) noexcept {
+            // Find the last slot in the chain
+            _Slot* last = first;
+            for (std::size_t i = 1; i < count; i++) {
+                last = last->next;
+            }
+
+            std::lock_guard<std::mutex> lock(this->mutex);
+            last->next = this->free_list;
+            this->free_list = first;
+        }
+
+    public:
+        /* ----------------------------------------------Definitions------------------------------------------------ */
+        // Distance in bytes between two adjacent slots
+        static constexpr std::size_t slot_size = sizeof(_Slot);
+
+        /* ----------------------------------------------Constructors----------------------------------------------- */
+        _node_pool(const _node_pool&) = delete;
+
+        _node_pool(_node_pool&&) = delete;
+
+        /* -----------------------------------------------Destructor------------------------------------------------ */
+        ~_node_pool() noexcept = default;
+
+        /* ------------------------------------------Overloaded Operators------------------------------------------- */
+        _node_pool& operator=(const _node_pool&) = delete;
+
+        _node_pool& operator=(_node_pool&&) = delete;
+
+        /* ------------------------------------------------Methods-------------------------------------------------- */
+        static _node_pool& instance() noexcept {
+            // The pool is intentionally never destroyed so that containers with static storage duration can still
+            // deallocate into it during program termination
+            static _node_pool* pool = new _node_pool();
+            return *pool;
+        }
+
+        [[nodiscard]] void* allocate() {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            return this->_take_slot();
+        }
+
+        void deallocate(void* ptr) noexcept {
+            _Slot* slot = static_cast<_Slot*>(ptr);
+
+            std::lock_guard<std::mutex> lock(this->mutex);
+            slot->next = this->free_list;
+            this->free_list = slot;
+        }
+
+        // Takes `count` slots under a single lock acquisition (recycled slots first) and returns the first of them, each
+        // slot linked to the next through chain_next()
+        [[nodiscard]] void* allocate_chain(std::size_t count) {
+            _Slot* first = nullptr;
+            _Slot** link = &first;
+
+            std::lock_guard<std::mutex> lock(this->mutex);
+            for (std::size_t i = 0; i < count; i++) {
+                *link = this->_take_slot();
+                link = &((*link)->next);
+            }
+            *link = nullptr;
+
+            return first;
+        }
+
+        // The slot after `slot` in a chain returned by allocate_chain(); must be read before `slot` is written to
+        [[nodiscard]] static void* chain_next(void* slot) noexcept { return static_cast<_Slot*>(slot)->next; }
+
+        // Returns `count` adjacent slots carved out of a block of their own. Each slot is independent of the others
+        // and is handed back with deallocate() (or deallocate_cached()) on its own, like any other slot
+        [[nodiscard]] void* allocate_contiguous(std::size_t count) {
+            return ::operator new(count * sizeof(_Slot), std::align_val_t(slot_align));
+        }
+
+        [[nodiscard]] void* allocate_cached() {
+            _Cache& cache = _cache();
+
+            // Refill the cache with a whole batch of slots under a single lock acquisition
+            if (cache.free_list == nullptr) {
+                std::lock_guard<std::mutex> lock(this->mutex);
+
+                for (std::size_t i = 0; i < batch_size; i++) {
+                    _Slot* slot = this->_take_slot();
+                    slot->next = cache.free_list;
+                    cache.free_list = slot;
+                }
+                cache.count = batch_size;
+            }
+
+            _Slot* slot = cache.free_list;
+            cache.free_list = slot->next;
+            cache.count--;
+
+            return slot;
+        }
+
+        void deallocate_cached(void* ptr) noexcept {
+            _Cache& cache = _cache();
+            _Slot* slot = static_cast<_Slot*>(ptr);
+
+            slot->next = cache.free_list;
+            cache.free_list = slot;
+            cache.count++;
+
+            // Bound the cache by handing a batch back to the pool once it holds two batches
+            if (cache.count >= 2 * batch_size) {
+                _Slot* first = cache.free_list;
+                _Slot* last = first;
+                for (std::size_t i = 1; i < batch_size; i++) {
+                    last = last->next;
+                }
+
+                cache.free_list = last->next;
+                cache.count -= batch_size;
+
+                last->next = nullptr;
+                this->_release_chain(first, batch_size);
+            }
+        }
+
+    };
+
+    template<class T, std::size_t BlockSize = 64 * 1024, bool ThreadCache = false>
+    class node_pool_allocator {
+    private:
+        /* ----------------------------------------------Definitions------------------------------------------------ */
+        using _pool = _node_pool<sizeof(T), alignof(T), BlockSize>;
+
+    public:
+        /* ----------------------------------------------Definitions------------------------------------------------ */
+        using value_type = T;
+
+        using size_type = std::size_t;
+
+        using difference_type = std::ptrdiff_t;
+
+        using propagate_on_container_copy_assignment = std::true_type;
+
+        using propagate_on_container_move_assignment = std::true_type;
+
+        using propagate_on_container_swap = std::true_type;
+
+        using is_always_equal = std::true_type;
+
+        template<class U>
+        struct rebind {
+            using other = node_pool_allocator<U, BlockSize, ThreadCache>;
+        };
+
+        /* ----------------------------------------------Constructors----------------------------------------------- */
+        constexpr node_pool_allocator() noexcept = default;
+
+        constexpr node_pool_allocator(const node_pool_allocator&) noexcept = default;
+
+        template<class U>
+        constexpr node_pool_allocator(const node_pool_allocator<U, BlockSize, ThreadCache>&) noexcept {}
+
+        /* -----------------------------------------------Destructor------------------------------------------------ */
+        constexpr ~node_pool_allocator() noexcept = default;
+
+        /* ------------------------------------------Overloaded Operators------------------------------------------- */
+        constexpr node_pool_allocator& operator=(const node_pool_allocator&) noexcept = default;
+
+        template<class U>
+        [[nodiscard]] constexpr bool operator==(const node_pool_allocator<U, BlockSize, ThreadCache>&) const noexcept {
+            return true;
+        }
+
+        /* ------------------------------------------------Methods-------------------------------------------------- */
+        [[nodiscard]] T* allocate(size_type n) {
+            // Only single objects (i.e. nodes) come from the pool; arrays go straight to the global heap
+            if (n != 1) {
+                return std::allocator<T>().allocate(n);
+            }
+
+            if constexpr (ThreadCache) {
+                return static_cast<T*>(_pool::instance().allocate_cached());
+            } else {
+                return static_cast<T*>(_pool::instance().allocate());
+            }
+        }
+
+        // Allocates storage for `n` objects with a single lock acquisition. The storage is returned as a chain: the
+        // first object's address, from which chain_next() reaches the others. Each object is deallocated on its own
+        // with deallocate(ptr, 1)
+        [[nodiscard]] T* allocate_chain(size_type n) { return static_cast<T*>(_pool::instance().allocate_chain(n)); }
+
+        // The object after `ptr` in a chain returned by allocate_chain(). Must be called before an object is
+        // constructed at `ptr`, since the link lives in its storage
+        [[nodiscard]] static T* chain_next(T* ptr) noexcept { return static_cast<T*>(_pool::chain_next(ptr)); }
+
+        // Allocates `n` adjacent objects that, unlike those of allocate(n), are deallocated one at a time with
+        // deallocate(ptr, 1). Only available when objects are exactly one slot apart
+        [[nodiscard]] T* allocate_contiguous(size_type n) requires (_pool::slot_size == sizeof(T)) {
+            return static_cast<T*>(_pool::instance().allocate_contiguous(n));
+        }
+
+        void deallocate(T* ptr, size_type n) noexcept {
+            if (n != 1) {
+                std::allocator<T>().deallocate(ptr, n);
+                return;
+            }
+
+            if constexpr (ThreadCache) {
+                _pool::instance().deallocate_cached(ptr);
+            } else {
+                _pool::instance().deallocate(ptr);
+            }
+        }
+
+    };
+
+} // adt
+
+
+#endif // NODE_POOL_ALLOCATOR_HPP
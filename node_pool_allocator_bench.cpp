@@ -0,0 +1,109 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <fstream>
+#include <vector>
+#include <unistd.h> // sysconf()
+
+#include "node_pool_allocator.hpp"
+#include "singly_list.hpp"
+
+
+/* -------------------------------------------Definitions---------------------------------------------------- */
+using value_type = int;
+
+/* ---------------------------------------------Helpers------------------------------------------------------ */
+// Resident set size of the whole process in MiB (Linux only; 0 elsewhere). The value accumulates across
+// benchmarks, so filter on a single allocator (--benchmark_filter) to compare footprints
+static double resident_mib() {
+	std::ifstream statm("/proc/self/statm");
+	std::size_t total_pages = 0,
+				resident_pages = 0;
+
+	if (!(statm >> total_pages >> resident_pages)) {
+		return 0.0;
+	}
+
+	return static_cast<double>(resident_pages) * static_cast<double>(sysconf(_SC_PAGESIZE)) / (1024.0 * 1024.0);
+}
+
+/* ----------------------------------------Insert/Erase Churn Benchmarks------------------------------------- */
+// Keeps a list of `n` elements and repeatedly erases every other node and inserts it back, which is the
+// allocation pattern of a long-lived work list
+template<class Allocator>
+static void bench_churn(benchmark::State& state) {
+	const std::size_t n = static_cast<std::size_t>(state.range(0));
+	adt::singly_list<value_type, Allocator> list(n);
+
+	for (auto _ : state) {
+		// Erase every other node
+		for (auto pos = list.cbegin(); pos != list.cend() && pos + 1 != list.cend(); ++pos) {
+			list.erase_after(pos);
+		}
+
+		// Insert a node after every remaining node
+		for (auto pos = list.cbegin(); pos != list.cend(); pos += 2) {
+			list.insert_after(pos, 0);
+		}
+	}
+
+	state.counters["rss_MiB"] = resident_mib();
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(bench_churn<std::allocator<value_type>>)->Name("churn<std::allocator>")
+	->RangeMultiplier(10)->Range(1'000, 1'000'000);
+BENCHMARK(bench_churn<adt::node_pool_allocator<value_type>>)->Name("churn<adt::node_pool_allocator>")
+	->RangeMultiplier(10)->Range(1'000, 1'000'000);
+BENCHMARK(bench_churn<adt::node_pool_allocator<value_type, 64 * 1024, true>>)
+	->Name("churn<adt::node_pool_allocator, thread cache>")->RangeMultiplier(10)->Range(1'000, 1'000'000);
+
+/* -------------------------------------Allocation Throughput Benchmarks------------------------------------- */
+// Builds and destroys a list of `n` elements, i.e. `n` allocations followed by `n` deallocations
+template<class Allocator>
+static void bench_fill_and_clear(benchmark::State& state) {
+	const std::size_t n = static_cast<std::size_t>(state.range(0));
+	adt::singly_list<value_type, Allocator> list;
+
+	for (auto _ : state) {
+		for (std::size_t i = 0; i < n; i++) {
+			list.push_front(static_cast<value_type>(i));
+		}
+
+		benchmark::DoNotOptimize(list.front());
+		list.clear();
+	}
+
+	state.counters["rss_MiB"] = resident_mib();
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(bench_fill_and_clear<std::allocator<value_type>>)->Name("fill_and_clear<std::allocator>")
+	->RangeMultiplier(10)->Range(1'000, 1'000'000);
+BENCHMARK(bench_fill_and_clear<adt::node_pool_allocator<value_type>>)->Name("fill_and_clear<adt::node_pool_allocator>")
+	->RangeMultiplier(10)->Range(1'000, 1'000'000);
+BENCHMARK(bench_fill_and_clear<adt::node_pool_allocator<value_type, 64 * 1024, true>>)
+	->Name("fill_and_clear<adt::node_pool_allocator, thread cache>")->RangeMultiplier(10)->Range(1'000, 1'000'000);
+
+/* ------------------------------------------Bulk Load Benchmarks-------------------------------------------- */
+// Builds a list of `n` elements from a sized range, which allocates every node at once when the allocator
+// supports it
+template<class Allocator>
+static void bench_range_construct(benchmark::State& state) {
+	const std::size_t n = static_cast<std::size_t>(state.range(0));
+	std::vector<value_type> values(n);
+
+	for (std::size_t i = 0; i < n; i++) {
+		values[i] = static_cast<value_type>(i);
+	}
+
+	for (auto _ : state) {
+		adt::singly_list<value_type, Allocator> list(values.begin(), values.end());
+		benchmark::DoNotOptimize(list.back());
+	}
+
+	state.counters["rss_MiB"] = resident_mib();
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(bench_range_construct<std::allocator<value_type>>)->Name("range_construct<std::allocator>")
+	->RangeMultiplier(10)->Range(1'000, 10'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_range_construct<adt::node_pool_allocator<value_type>>)->Name("range_construct<adt::node_pool_allocator>")
+	->RangeMultiplier(10)->Range(1'000, 10'000'000)->Unit(benchmark::kMillisecond);
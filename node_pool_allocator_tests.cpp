@@ -0,0 +1,214 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "node_pool_allocator.hpp"
+#include "singly_list.hpp"
+
+
+/* -------------------------------------------Definitions---------------------------------------------------- */
+using pool_allocator = adt::node_pool_allocator<int>;
+
+using cached_pool_allocator = adt::node_pool_allocator<int, 4 * 1024, true>;
+
+/* ------------------------------------Node Pool Allocator Methods Tests------------------------------------- */
+TEST(node_pool_allocator__methods, allocate__recycles_slots) {
+	pool_allocator allocator;
+
+	int* first = allocator.allocate(1);
+	allocator.deallocate(first, 1);
+
+	int* second = allocator.allocate(1);
+
+	EXPECT_EQ(first, second);
+	allocator.deallocate(second, 1);
+}
+
+TEST(node_pool_allocator__methods, allocate__distinct_slots) {
+	pool_allocator allocator;
+	std::vector<int*> slots;
+
+	// Enough slots to span several blocks
+	for (int i = 0; i < 100'000; i++) {
+		slots.push_back(allocator.allocate(1));
+		*slots.back() = i;
+	}
+
+	for (int i = 0; i < 100'000; i++) {
+		EXPECT_EQ(*slots[i], i);
+	}
+
+	for (int* slot : slots) {
+		allocator.deallocate(slot, 1);
+	}
+}
+
+TEST(node_pool_allocator__methods, allocate__array) {
+	pool_allocator allocator;
+
+	int* array = allocator.allocate(16);
+	for (int i = 0; i < 16; i++) {
+		array[i] = i;
+	}
+
+	EXPECT_EQ(array[15], 15);
+	allocator.deallocate(array, 16);
+}
+
+TEST(node_pool_allocator__methods, allocate__thread_cache) {
+	std::vector<std::thread> threads;
+
+	for (int t = 0; t < 4; t++) {
+		threads.emplace_back([]() -> void {
+			cached_pool_allocator allocator;
+			std::vector<int*> slots;
+
+			for (int round = 0; round < 10; round++) {
+				for (int i = 0; i < 1'000; i++) {
+					slots.push_back(allocator.allocate(1));
+					*slots.back() = i;
+				}
+
+				for (int i = 0; i < 1'000; i++) {
+					EXPECT_EQ(*slots[i], i);
+					allocator.deallocate(slots[i], 1);
+				}
+				slots.clear();
+			}
+		});
+	}
+
+	for (std::thread& thread : threads) {
+		thread.join();
+	}
+}
+
+TEST(node_pool_allocator__methods, allocate_chain__distinct_slots) {
+	pool_allocator allocator;
+	std::vector<int*> slots;
+
+	int* slot = allocator.allocate_chain(1'000);
+	for (int i = 0; i < 1'000; i++) {
+		int* next = pool_allocator::chain_next(slot);
+		slots.push_back(slot);
+		*slot = i;
+		slot = next;
+	}
+
+	for (int i = 0; i < 1'000; i++) {
+		EXPECT_EQ(*slots[i], i);
+		allocator.deallocate(slots[i], 1);
+	}
+}
+
+TEST(node_pool_allocator__methods, allocate_contiguous__adjacent_slots) {
+	adt::node_pool_allocator<std::uint64_t> allocator;
+
+	std::uint64_t* slots = allocator.allocate_contiguous(1'000);
+	for (std::uint64_t i = 0; i < 1'000; i++) {
+		slots[i] = i;
+	}
+
+	EXPECT_EQ(slots[999], 999);
+
+	// Every slot goes back to the pool on its own
+	for (std::uint64_t i = 0; i < 1'000; i++) {
+		allocator.deallocate(slots + i, 1);
+	}
+}
+
+/* -----------------------------------Node Pool Allocator Operators Tests------------------------------------ */
+TEST(node_pool_allocator__operators, equals_operator__rebind) {
+	pool_allocator allocator;
+	adt::node_pool_allocator<double> other(allocator);
+
+	EXPECT_TRUE(allocator == other);
+	EXPECT_TRUE((std::is_same_v<std::allocator_traits<pool_allocator>::rebind_alloc<double>,
+								adt::node_pool_allocator<double>>));
+}
+
+/* ------------------------------------Singly List With Node Pool Tests-------------------------------------- */
+TEST(node_pool_allocator__singly_list, insert_and_erase_churn) {
+	adt::singly_list<int, pool_allocator> list;
+
+	for (int round = 0; round < 10; round++) {
+		for (int i = 0; i < 1'000; i++) {
+			list.push_back(i);
+		}
+
+		list.remove_if([](int value) -> bool { return value % 2 == 0; });
+		EXPECT_EQ(list.size(), 500);
+
+		list.clear();
+	}
+
+	EXPECT_TRUE(list.empty());
+}
+
+TEST(node_pool_allocator__singly_list, splice_after__relinks_nodes) {
+	adt::singly_list<int, cached_pool_allocator> list = {1, 2, 3},
+												 other = {4, 5, 6};
+	const int* front = &other.front();
+	std::initializer_list<int> matcher = {1, 2, 3, 4, 5, 6};
+
+	list.splice_after(list.cbegin() + 2, other);
+
+	EXPECT_EQ(list, matcher);
+	EXPECT_EQ(&*(list.cbegin() + 3), front);
+	EXPECT_TRUE(other.empty());
+}
+
+TEST(node_pool_allocator__singly_list, sort) {
+	adt::singly_list<int, pool_allocator> list = {5, 3, 6, 1, 4, 2};
+	std::initializer_list<int> matcher = {1, 2, 3, 4, 5, 6};
+
+	list.sort();
+
+	EXPECT_EQ(list, matcher);
+	EXPECT_EQ(list.back(), 6);
+}
+
+TEST(node_pool_allocator__singly_list, compact__contiguous_nodes) {
+	adt::singly_list<int, pool_allocator> list;
+	std::vector<int> matcher;
+
+	for (int i = 0; i < 1'000; i++) {
+		list.push_front((i * 7919) % 1'000);
+	}
+	list.sort();
+	for (int i = 0; i < 1'000; i++) {
+		matcher.push_back(i);
+	}
+
+	list.compact();
+
+	EXPECT_TRUE(std::equal(list.begin(), list.end(), matcher.begin(), matcher.end()));
+	EXPECT_EQ(list.back(), 999);
+
+	// Consecutive elements now sit one node apart in memory, in traversal order
+	const std::ptrdiff_t stride = reinterpret_cast<const char*>(&*(list.cbegin() + 1)) -
+								  reinterpret_cast<const char*>(&list.front());
+	EXPECT_GT(stride, 0);
+	for (auto it = list.cbegin(); it + 1 != list.cend(); ++it) {
+		EXPECT_EQ(reinterpret_cast<const char*>(&*(it + 1)) - reinterpret_cast<const char*>(&*it), stride);
+	}
+}
+
+TEST(node_pool_allocator__singly_list, range_constructor__bulk) {
+	std::vector<int> values(1'000);
+	for (int i = 0; i < 1'000; i++) {
+		values[i] = i;
+	}
+
+	adt::singly_list<int, pool_allocator> list(values.begin(), values.end());
+	list.append_range(values);
+	list.insert_after(list.cbegin(), 3, -1);
+
+	EXPECT_EQ(list.size(), 2'003);
+	EXPECT_EQ(list.back(), 999);
+	EXPECT_EQ(*(list.cbegin() + 3), -1);
+	EXPECT_TRUE(std::equal(list.begin() + 4, list.begin() + 1'003, values.begin() + 1, values.end()));
+}
@@ -6,19 +6,110 @@
 #define SINGLY_LIST_HPP
 
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <initializer_list>
 #include <stdexcept>
 #include <algorithm>
 #include <ranges>
-#include <unordered_set>
+#include <vector>
+#include <functional>
+#include <bit>
 #include <compare>
 #include <concepts>
-
+#include <limits>
+#include <utility>
+#include <thread>
+#include <system_error>
+#include <optional>
+#include <numeric>
+
+
+// Whether iterators of adt::singly_list throw std::runtime_error when dereferenced or advanced past the end of the
+// list. Unless defined by the user, iterators are checked in debug builds and unchecked (and noexcept) when NDEBUG is
+// defined
+#ifndef ADT_SINGLY_LIST_CHECKED
+#ifdef NDEBUG
+#define ADT_SINGLY_LIST_CHECKED false
+#else
+#define ADT_SINGLY_LIST_CHECKED true
+#endif
+#endif
+
+// How many nodes ahead of the current one the internal traversals of adt::singly_list prefetch (0 disables
+// prefetching). Each step of the look-ahead is itself a dependent load, so prefetching only pays off when there is
+// work to overlap with it; see the traversal benchmarks in singly_list_bench.cpp
+#ifndef ADT_SINGLY_LIST_PREFETCH_DISTANCE
+#define ADT_SINGLY_LIST_PREFETCH_DISTANCE 0
+#endif
+
+// How many erased nodes an adt::singly_list keeps by default for its next insertions (0 disables the node cache). Each
+// list can change it with set_node_cache_capacity()
+#ifndef ADT_SINGLY_LIST_NODE_CACHE_CAPACITY
+#define ADT_SINGLY_LIST_NODE_CACHE_CAPACITY 0
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define ADT_PREFETCH(address) __builtin_prefetch(address)
+#else
+#define ADT_PREFETCH(address) static_cast<void>(address)
+#endif
 
 namespace adt {
 
-    template<class T, class Allocator = std::allocator<T>>
+    namespace execution {
+
+        // Selects the parallel overloads of adt::singly_list's algorithms. It mirrors std::execution::par without
+        // including <execution>, which with libstdc++ makes every program that includes it link against TBB. It is
+        // also the default executor, which starts a thread per task
+        struct parallel_policy {
+            /* ------------------------------------------------Methods---------------------------------------------- */
+            [[nodiscard]] std::size_t concurrency() const noexcept {
+                return std::max(std::thread::hardware_concurrency(), 1u);
+            }
+
+            // Runs `task(i)` for every i in [0, count), each on a thread of its own except i = 0 which runs on the
+            // calling thread, and waits for all of them. A task whose thread cannot be started runs on the calling
+            // thread instead
+            template<class Task>
+            void bulk_execute(std::size_t count, Task task) const noexcept {
+                std::vector<std::jthread> threads;
+
+                try {
+                    threads.reserve(count);
+                } catch (const std::bad_alloc&) {
+                    for (std::size_t i = 0; i < count; i++) {
+                        task(i);
+                    }
+                    return;
+                }
+
+                for (std::size_t i = 1; i < count; i++) {
+                    try {
+                        threads.emplace_back(task, i);
+                    } catch (const std::system_error&) {
+                        task(i);
+                    }
+                }
+                task(0);
+            }
+
+        };
+
+        inline constexpr parallel_policy par{};
+
+        // What the parallel algorithms run their tasks on, e.g. a thread pool. bulk_execute(count, task) calls `task(i)`
+        // for every i in [0, count), possibly concurrently, and returns once every call has returned. concurrency() is
+        // the number of tasks worth running at once
+        template<class Executor>
+        concept executor = requires (Executor& executor, std::size_t count, void (*task)(std::size_t)) {
+            { executor.concurrency() } -> std::convertible_to<std::size_t>;
+            executor.bulk_execute(count, task);
+        };
+
+    } // execution
+
+    template<class T, class Allocator = std::allocator<T>, bool Checked = ADT_SINGLY_LIST_CHECKED>
     class singly_list {
     public:
         /* -----------------------------------------------Definitions----------------------------------------------- */
@@ -38,6 +129,8 @@ namespace adt {
 
         using const_pointer = typename std::allocator_traits<allocator_type>::const_pointer;
 
+        static constexpr size_type prefetch_distance = ADT_SINGLY_LIST_PREFETCH_DISTANCE;
+
     private:
         /* -------------------------------------------------Node---------------------------------------------------- */
         struct _Node {
@@ -53,6 +146,15 @@ namespace adt {
 
             constexpr _Node(const_reference value, _Node* next) noexcept : value(value), next(next) {}
 
+            constexpr _Node(value_type&& value) noexcept : value(std::move(value)), next(nullptr) {}
+
+            constexpr _Node(value_type&& value, _Node* next) noexcept : value(std::move(value)), next(next) {}
+
+            // Constructs the value in place from `args`
+            template<class... Args>
+            constexpr _Node(std::in_place_t, _Node* next, Args&&... args) noexcept
+                : value(std::forward<Args>(args)...), next(next) {}
+
             constexpr _Node(const _Node&) noexcept = default;
 
             constexpr _Node(_Node&&) noexcept = default;
@@ -71,6 +173,46 @@ namespace adt {
 
         };
 
+        /* -----------------------------------------------Free Node------------------------------------------------- */
+        // What the storage of a node in the node cache holds once its value has been destroyed
+        struct _FreeNode {
+            /* --------------------------------------------Fields--------------------------------------------------- */
+            _FreeNode* next;
+        };
+
+        /* -----------------------------------------------Prefetcher------------------------------------------------- */
+        // A cursor that runs `Distance` nodes ahead of a traversal and prefetches every node it reaches. Construct it
+        // at the first node the traversal examines and step() it once per iteration: it then stays at least
+        // `Distance` nodes ahead, so nodes the traversal erases are never touched by it. A distance of 0 disables it
+        template<size_type Distance>
+        struct _Prefetcher {
+            /* --------------------------------------------Fields--------------------------------------------------- */
+            const _Node* ahead;
+
+            /* -----------------------------------------Constructors------------------------------------------------ */
+            constexpr explicit _Prefetcher(const _Node* node) noexcept : ahead(node) {
+                if constexpr (Distance > 0) {
+                    for (size_type i = 0; i < Distance && this->ahead != nullptr; i++) {
+                        this->ahead = this->ahead->next;
+                    }
+                }
+            }
+
+            /* --------------------------------------------Methods-------------------------------------------------- */
+            constexpr void step() noexcept {
+                if constexpr (Distance > 0) {
+                    if (this->ahead != nullptr) {
+                        this->ahead = this->ahead->next;
+
+                        if !consteval {
+                            ADT_PREFETCH(this->ahead);
+                        }
+                    }
+                }
+            }
+
+        };
+
         /* ----------------------------------------------Definitions------------------------------------------------ */
         using allocator_traits = typename std::allocator_traits<allocator_type>;
 
@@ -78,31 +220,214 @@ namespace adt {
 
         using node_allocator_traits = typename std::allocator_traits<_NodeAllocator>;
 
+        // Whether the node allocator can hand out nodes that are adjacent in memory yet individually deallocated
+        // (e.g. adt::node_pool_allocator)
+        static constexpr bool _has_contiguous_allocation = requires (_NodeAllocator& allocator, size_type n) {
+            { allocator.allocate_contiguous(n) } -> std::same_as<_Node*>;
+        };
+
+        // Whether the node allocator can hand out many individually deallocated nodes in one call, as a chain linked
+        // through their storage (e.g. adt::node_pool_allocator)
+        static constexpr bool _has_chain_allocation = requires (_NodeAllocator& allocator, size_type n, _Node* node) {
+            { allocator.allocate_chain(n) } -> std::same_as<_Node*>;
+            { allocator.chain_next(node) } -> std::same_as<_Node*>;
+        };
+
         /* ------------------------------------------------Fields--------------------------------------------------- */
         _Node dummy;
 
         _Node* head;
 
+        _Node* tail;
+
         allocator_type allocator;
 
         _NodeAllocator node_allocator;
 
         size_type sz;
 
+        // Storage of erased nodes kept for the next insertions, up to `free_capacity` of them
+        _FreeNode* free_nodes = nullptr;
+
+        size_type free_count = 0;
+
+        size_type free_capacity = ADT_SINGLY_LIST_NODE_CACHE_CAPACITY;
+
         /* ------------------------------------------------Methods-------------------------------------------------- */
+        // Takes the storage for a node from the node cache, or from the allocator if the cache is empty
+        constexpr _Node* _allocate_node() noexcept {
+            if (this->free_nodes != nullptr) {
+                _FreeNode* free_node = this->free_nodes;
+                this->free_nodes = free_node->next;
+                this->free_count--;
+
+                return reinterpret_cast<_Node*>(free_node);
+            }
+
+            return node_allocator_traits::allocate(this->node_allocator, 1);
+        }
+
+        // Keeps the storage of a destroyed node in the node cache if it has room, otherwise frees it
+        constexpr void _deallocate_node(_Node* node) noexcept {
+            if !consteval {
+                if (this->free_count < this->free_capacity) {
+                    this->free_nodes = ::new (static_cast<void*>(node)) _FreeNode{this->free_nodes};
+                    this->free_count++;
+                    return;
+                }
+            }
+
+            node_allocator_traits::deallocate(this->node_allocator, node, 1);
+        }
+
+        // Frees the node cache down to `count` nodes
+        constexpr void _release_free_nodes(size_type count = 0) noexcept {
+            while (this->free_count > count) {
+                _FreeNode* free_node = this->free_nodes;
+                this->free_nodes = free_node->next;
+                this->free_count--;
+
+                node_allocator_traits::deallocate(this->node_allocator, reinterpret_cast<_Node*>(free_node), 1);
+            }
+        }
+
         constexpr _Node* _create_node(const_reference value, _Node* next = nullptr) noexcept {
-            _Node* node = node_allocator_traits::allocate(this->node_allocator, 1);
+            _Node* node = this->_allocate_node();
             node_allocator_traits::construct(this->node_allocator, node, value, next);
             return node;
         }
 
+        constexpr _Node* _create_node(value_type&& value, _Node* next = nullptr) noexcept {
+            _Node* node = this->_allocate_node();
+            node_allocator_traits::construct(this->node_allocator, node, std::move(value), next);
+            return node;
+        }
+
+        // Constructs a node with no successor in the allocated storage `node`, its value constructed in place from `args`
+        template<class... Args>
+        constexpr void _construct_node(_Node* node, Args&&... args) noexcept {
+            node_allocator_traits::construct(this->node_allocator, node, std::in_place, nullptr,
+                                             std::forward<Args>(args)...);
+        }
+
+        // Creates a node whose value is constructed in place from `args`, without any intermediate temporary
+        template<class... Args>
+        constexpr _Node* _emplace_node(_Node* next, Args&&... args) noexcept {
+            _Node* node = this->_allocate_node();
+            this->_construct_node(node, std::forward<Args>(args)...);
+            node->next = next;
+            return node;
+        }
+
+        // Creates a detached chain of `count` (> 0) nodes, calling `construct(node)` on each node's storage in order.
+        // Unless `Contiguous`, the node cache is drained first. The other nodes come from a single allocator call when
+        // the allocator supports it: allocate_contiguous() if `Contiguous` (the nodes are then laid out sequentially in
+        // memory), otherwise allocate_chain() (which may recycle freed nodes). Returns the first and last nodes of the
+        // chain
+        template<bool Contiguous = false, class Construct>
+        constexpr std::pair<_Node*, _Node*> _create_chain(size_type count, Construct construct) noexcept {
+            _Node* first = nullptr,
+                 * last = nullptr;
+            _Node** link = &first;
+
+            if constexpr (!Contiguous) {
+                for (; count > 0 && this->free_nodes != nullptr; count--) {
+                    last = this->_allocate_node();
+                    construct(last);
+
+                    *link = last;
+                    link = &(last->next);
+                }
+
+                if (count == 0) {
+                    return {first, last};
+                }
+            }
+
+            if constexpr (Contiguous && _has_contiguous_allocation) {
+                _Node* nodes = this->node_allocator.allocate_contiguous(count);
+
+                for (size_type i = 0; i < count; i++) {
+                    last = nodes + i;
+                    construct(last);
+
+                    *link = last;
+                    link = &(last->next);
+                }
+            } else if constexpr (_has_chain_allocation) {
+                _Node* node = this->node_allocator.allocate_chain(count);
+
+                for (size_type i = 0; i < count; i++) {
+                    // Read the link to the next node's storage before it is overwritten
+                    _Node* next = this->node_allocator.chain_next(node);
+                    last = node;
+                    construct(last);
+
+                    *link = last;
+                    link = &(last->next);
+                    node = next;
+                }
+            } else {
+                for (size_type i = 0; i < count; i++) {
+                    last = Contiguous ? node_allocator_traits::allocate(this->node_allocator, 1) : this->_allocate_node();
+                    construct(last);
+
+                    *link = last;
+                    link = &(last->next);
+                }
+            }
+
+            return {first, last};
+        }
+
+        // Creates a chain of `count` nodes (see _create_chain()) and links it in after `pos_node`. Returns the last
+        // node inserted, or `pos_node` if `count` is 0
+        template<class Construct>
+        constexpr _Node* _insert_chain_after(_Node* pos_node, size_type count, Construct construct) noexcept {
+            if (count == 0) {
+                return pos_node;
+            }
+
+            auto [first, last] = this->_create_chain(count, construct);
+
+            last->next = pos_node->next;
+            pos_node->next = first;
+            if (pos_node == this->tail) {
+                this->tail = last;
+            }
+            this->sz += count;
+
+            return last;
+        }
+
+        // Inserts copies of (or, for ranges of rvalues, moves) the elements of [`first`, `last`) after `pos_node`,
+        // in bulk when the size of the range is known up front. Returns the last node inserted, or `pos_node`
+        template<std::input_iterator InputIt, std::sentinel_for<InputIt> Sentinel>
+        constexpr _Node* _insert_range_after(_Node* pos_node, InputIt first, Sentinel last) noexcept {
+            if constexpr (std::forward_iterator<InputIt>) {
+                const size_type count = static_cast<size_type>(std::ranges::distance(first, last));
+
+                return this->_insert_chain_after(pos_node, count, [&](_Node* node) -> void {
+                    this->_construct_node(node, *first);
+                    ++first;
+                });
+            } else {
+                for (; first != last; ++first) {
+                    this->_insert_after(pos_node, *first);
+                    pos_node = pos_node->next;
+                }
+
+                return pos_node;
+            }
+        }
+
         constexpr _Node* _delete_node(_Node* node) noexcept {
             if (node == nullptr) {
                 return nullptr;
             }
 
             node_allocator_traits::destroy(this->node_allocator, node);
-            node_allocator_traits::deallocate(this->node_allocator, node, 1);
+            this->_deallocate_node(node);
             return nullptr;
         }
 
@@ -117,14 +442,24 @@ namespace adt {
 
                 node = next;
             }
+
+            // Reset the list to its empty state
+            this->head->next = nullptr;
+            this->tail = this->head;
         }
 
-        constexpr _Node* _insert_after(_Node* node, const_reference value) noexcept {
+        template<class... Args>
+        constexpr _Node* _insert_after(_Node* node, Args&&... args) noexcept {
             // Save a copy of the node after `node`
             _Node* next = node->next;
 
-            // Create a new node to store `value` and point `node->next` to the new node
-            node->next = this->_create_node(value, next);
+            // Create a new node constructed from `args` and point `node->next` to the new node
+            node->next = this->_emplace_node(next, std::forward<Args>(args)...);
+
+            // If `node` was the tail, the new node is now the tail
+            if (node == this->tail) {
+                this->tail = node->next;
+            }
             
             // Update the size counter
             this->sz++;
@@ -136,6 +471,11 @@ namespace adt {
             // Save a copy of the node two nodes after `node`
             _Node* next = node->next->next;
 
+            // If the node after `node` is the tail, `node` becomes the new tail
+            if (node->next == this->tail) {
+                this->tail = node;
+            }
+
             // Delete the node after `node`
             this->_delete_node(node->next);
 
@@ -148,167 +488,423 @@ namespace adt {
             return node->next;
         }
 
+        [[nodiscard]] constexpr bool _is_allocator_equal(const singly_list& other) const noexcept {
+            if constexpr (node_allocator_traits::is_always_equal::value) {
+                return true;
+            } else {
+                return this->node_allocator == other.node_allocator;
+            }
+        }
+
+        // Takes the whole chain of `other` in O(1), leaving `other` empty. `*this` must be empty and its allocator
+        // must be able to free the nodes of `other`
+        constexpr void _steal(singly_list& other) noexcept {
+            this->head->next = other.head->next;
+            other.head->next = nullptr;
+
+            // The tail only transfers if `other` was not empty
+            if (other.tail != other.head) {
+                this->tail = other.tail;
+                other.tail = other.head;
+            }
+
+            this->sz = other.sz;
+            other.sz = 0;
+        }
+
+        // Takes ownership of the detached chain `first`..`last` of `count` nodes, allocated by an allocator equal to
+        // `node_allocator`. `*this` must be empty
+        constexpr void _adopt_chain(_Node* first, _Node* last, size_type count) noexcept {
+            this->head->next = first;
+            this->tail = last;
+            this->sz = count;
+        }
+
+        // Moves the last `count` (<= size()) elements into a new list by relinking, walking only the size() - count
+        // nodes in front of them
+        [[nodiscard]] singly_list _split_back(size_type count) {
+            singly_list back(this->allocator);
+            if (count == 0) {
+                return back;
+            }
+
+            _Node* prev = this->head;
+            for (size_type i = count; i < this->sz; i++) {
+                prev = prev->next;
+            }
+
+            back._adopt_chain(prev->next, this->tail, count);
+            prev->next = nullptr;
+            this->tail = prev;
+            this->sz -= count;
+
+            return back;
+        }
+
+        // Moves every element of `other` into a node allocated by `*this`, then frees the nodes of `other`. `*this`
+        // must be empty
+        constexpr void _move_elements(singly_list& other) noexcept {
+            for (_Node* node = other.head->next; node != nullptr; node = node->next) {
+                this->tail->next = this->_create_node(std::move(node->value));
+                this->tail = this->tail->next;
+            }
+
+            this->sz = other.sz;
+            other._clear();
+            other.sz = 0;
+        }
+
         constexpr void _splice_after(_Node* pos_node, singly_list& other) noexcept {
-            _Node* other_prev = other.head->next;
-            _Node* temp;
+            // If the allocators differ, the nodes cannot change owners and must be copied instead
+            if (!this->_is_allocator_equal(other)) {
+                _Node* other_prev = other.head->next;
+                _Node* temp;
+
+                while (other_prev != nullptr) {
+                    // Copy the current node from `other` and insert it after `pos_node`
+                    pos_node->next = this->_create_node(std::move(other_prev->value), pos_node->next);
+                    if (pos_node == this->tail) {
+                        this->tail = pos_node->next;
+                    }
+                    pos_node = pos_node->next;
+                    this->sz++;
 
-            while (other_prev != nullptr) {
-                // Copy the current node from `other` and insert it after `pos_node`
-                pos_node->next = this->_create_node(other_prev->value, pos_node->next);
-                pos_node = pos_node->next;
-                this->sz++;
+                    // Remove the node containing `other_node->next->value` from `other`
+                    temp = other_prev;
+                    other_prev = other_prev->next;
+                    other._delete_node(temp);
+                }
 
-                // Remove the node containing `other_node->next->value` from `other`
-                temp = other_prev;
-                other_prev = other_prev->next;
-                this->_delete_node(temp);
+                other.head->next = nullptr;
+                other.tail = other.head;
+                other.sz = 0;
+                return;
             }
 
+            // Link the whole chain of `other` in between `pos_node` and the node after it
+            other.tail->next = pos_node->next;
+            pos_node->next = other.head->next;
+            if (pos_node == this->tail) {
+                this->tail = other.tail;
+            }
+            this->sz += other.sz;
+
+            // Leave `other` empty
             other.head->next = nullptr;
+            other.tail = other.head;
             other.sz = 0;
         }
 
         constexpr void _splice_after(_Node* pos_node, singly_list& other, _Node* it_node) noexcept {
-            // Copy and insert the node following `it_node` after `pos_node`
-            pos_node->next = this->_create_node(it_node->next->value, pos_node->next);
-            this->sz++;
+            _Node* node = it_node->next;
 
-            // Remove the node following `it_node` from `other`
-            _Node* temp = it_node->next;
-            it_node->next = it_node->next->next;
-            this->_delete_node(temp);
+            // Splicing a node after itself or after its own predecessor leaves the list unchanged
+            if (pos_node == it_node || pos_node == node) {
+                return;
+            }
+
+            // Unlink the node following `it_node` from `other`
+            if (node == other.tail) {
+                other.tail = it_node;
+            }
+            it_node->next = node->next;
             other.sz--;
+
+            // If the allocators differ, the node cannot change owners and must be copied instead
+            if (!this->_is_allocator_equal(other)) {
+                node->next = nullptr;
+                _Node* copy = this->_create_node(std::move(node->value));
+                other._delete_node(node);
+                node = copy;
+            }
+
+            // Link the node in after `pos_node`
+            node->next = pos_node->next;
+            pos_node->next = node;
+            if (pos_node == this->tail) {
+                this->tail = node;
+            }
+            this->sz++;
         }
 
         constexpr void _splice_after(_Node* pos_node, singly_list& other,
                                      _Node* first_node, _Node* last_node) noexcept {
-            _Node* temp;
+            // If the allocators differ, the nodes cannot change owners and must be copied instead
+            if (!this->_is_allocator_equal(other)) {
+                _Node* temp;
+
+                // While in the range (`first`, `last`) and the end of the list has NOT been reached...
+                while (first_node != nullptr && first_node->next != nullptr && first_node->next != last_node) {
+                    // Copy the current node from other and insert it after `pos_node`
+                    pos_node->next = this->_create_node(std::move(first_node->next->value), pos_node->next);
+                    if (pos_node == this->tail) {
+                        this->tail = pos_node->next;
+                    }
+                    this->sz++;
 
-            // While in the range (`first`, `last`) and the end of the list has NOT been reached...
-            while (first_node != nullptr && first_node->next != nullptr && first_node->next != last_node) {
-                // Copy the current node from other and insert it after `pos_node`
-                pos_node->next = this->_create_node(first_node->next->value, pos_node->next);
-                this->sz++;
+                    // Delete the original node from other
+                    if (first_node->next == other.tail) {
+                        other.tail = first_node;
+                    }
+                    temp = first_node->next->next;
+                    other._delete_node(first_node->next);
+                    first_node->next = temp;
+                    other.sz--;
 
-                // Delete the original node from other
-                temp = first_node->next->next;
-                this->_delete_node(first_node->next);
-                first_node->next = temp;
-                other.sz--;
+                    // Advance to the next node
+                    pos_node = pos_node->next;
+                }
+                return;
+            }
 
-                // Advance to the next node
-                pos_node = pos_node->next;
+            // Return if the range (`first`, `last`) is empty
+            if (first_node == nullptr || first_node->next == nullptr || first_node->next == last_node) {
+                return;
             }
-        }
 
-        constexpr void _resize(size_type new_size, const_reference value) noexcept {
-            if (new_size > this->sz) {
-                // Calculate the number of new nodes to allocate
-                size_type num_nodes_to_alloc = new_size - this->sz;
+            // Find the last node in the range (`first`, `last`) and count the nodes being moved
+            _Node* range_first = first_node->next,
+                 * range_last = range_first;
+            size_type count = 1;
 
-                // Update the `this->sz`
-                this->sz = new_size;
+            while (range_last->next != nullptr && range_last->next != last_node) {
+                range_last = range_last->next;
+                count++;
+            }
 
-                // Get to the tail of the list
-                _Node* tail = this->head;
-                while (tail->next != nullptr) {
-                    tail = tail->next;
-                }
+            // Unlink the range from `other`
+            first_node->next = range_last->next;
+            if (range_last == other.tail) {
+                other.tail = first_node;
+            }
+            other.sz -= count;
 
-                // Insert `num_nodes_to_alloc` nodes after `tail`
-                for (size_type i = 0; i < num_nodes_to_alloc; i++) {
-                    tail->next = this->_create_node(value);
-                    tail = tail->next;
-                }
+            // Link the range in after `pos_node`
+            range_last->next = pos_node->next;
+            pos_node->next = range_first;
+            if (pos_node == this->tail) {
+                this->tail = range_last;
+            }
+            this->sz += count;
+        }
+
+        constexpr void _resize(size_type new_size, const_reference value) noexcept {
+            if (new_size > this->sz) {
+                // Insert `new_size - this->sz` copies of `value` after the tail
+                this->_insert_chain_after(this->tail, new_size - this->sz, [&](_Node* node) -> void {
+                    this->_construct_node(node, value);
+                });
             } else if (new_size < this->sz) {
                 // Get to the new tail (`num_nodes_to_dealloc`th node)
-                _Node* new_tail = this->head,
-                     * next;
+                _Node* new_tail = this->head;
+                _Prefetcher<prefetch_distance> prefetcher(this->head->next);
                 for (size_type i = 0; i < new_size; i++) {
+                    prefetcher.step();
                     new_tail = new_tail->next;
                 }
 
-                // For all nodes after `new_tail`
-                while (new_tail->next != nullptr) {
-                    // Save a copy of the next node
-                    next = new_tail->next->next;
+                this->_truncate_after(new_tail, new_size);
+            }
+        }
 
-                    // Delete the current node
-                    this->_delete_node(new_tail->next);
-                    
-                    // Go to the next node
-                    new_tail->next = next;
-                }
-                new_tail->next = nullptr;
+        // Deletes every node after `new_tail`, the `new_size`th node, which becomes the tail
+        constexpr void _truncate_after(_Node* new_tail, size_type new_size) noexcept {
+            _Node* node = new_tail->next,
+                 * next;
 
-                // Update the size counter
-                this->sz = new_size;
+            while (node != nullptr) {
+                next = node->next;
+                this->_delete_node(node);
+                node = next;
             }
+            new_tail->next = nullptr;
+            this->tail = new_tail;
+
+            // Update the size counter
+            this->sz = new_size;
         }
 
-        static constexpr _Node* _merge_sort_split(_Node* node) noexcept {
-            _Node* fast = node,
-                 * slow = node,
-                 * temp;
+        // Replaces the elements of the list with those of [`first`, `last`): the values of the existing nodes are
+        // overwritten in place, and only the nodes missing are created or the nodes left over deleted
+        template<std::input_iterator InputIt, std::sentinel_for<InputIt> Sentinel>
+        constexpr void _assign_range(InputIt first, Sentinel last) noexcept {
+            _Node* prev = this->head;
+            size_type count = 0;
 
-            // While the end of the list has NOT been reached...
-            while (fast != nullptr && fast->next != nullptr) {
-                // Point `fast` two nodes ahead
-                fast = fast->next->next;
-
-                // If the end of the list has NOT been reached...
-                if (fast != nullptr) {
-                    // Point `slow` one node ahead
-                    slow = slow->next;
+            for (; first != last && prev->next != nullptr; ++first) {
+                prev->next->value = *first;
+                prev = prev->next;
+                count++;
+            }
+
+            if (first != last) {
+                // `prev` is the tail
+                this->_insert_range_after(prev, std::move(first), last);
+            } else {
+                this->_truncate_after(prev, count);
+            }
+        }
+
+        template<class Compare>
+        static constexpr _Node* _merge_sort_merge(_Node* first_half, _Node* second_half, Compare comp) noexcept {
+            _Node* merged = nullptr;
+            _Node** link = &merged;
+
+            // While both halves have nodes left to merge...
+            while (first_half != nullptr && second_half != nullptr) {
+                // Take from `second_half` only if it strictly precedes `first_half` to keep the merge stable
+                if (comp(second_half->value, first_half->value)) {
+                    *link = second_half;
+                    second_half = second_half->next;
+                } else {
+                    *link = first_half;
+                    first_half = first_half->next;
                 }
+
+                // Advance to the link of the node just merged
+                link = &((*link)->next);
             }
 
-            // Split the list in half
-            temp = slow->next;
-            slow->next = nullptr;
+            // Append whatever remains of the half that was not exhausted
+            *link = (first_half != nullptr) ? first_half : second_half;
 
-            // Return the second half
-            return temp;
+            return merged;
         }
 
         template<class Compare>
-        static constexpr _Node* _merge_sort_merge(_Node* first_half, _Node* second_half, Compare comp) noexcept {
-            if (first_half == nullptr) {
-                return second_half;
+        static constexpr _Node* _merge_sort(_Node* node, Compare comp) noexcept {
+            // `runs[i]` holds either nullptr or a sorted run of exactly 2^i nodes. Runs in higher slots always hold
+            // nodes that appeared earlier in the list, which keeps the sort stable
+            _Node* runs[std::numeric_limits<size_type>::digits] = {};
+            _Node* carry;
+            size_type i;
+
+            // While there are nodes left to sort...
+            while (node != nullptr) {
+                // Detach the next node as a sorted run of length 1
+                carry = node;
+                node = node->next;
+                carry->next = nullptr;
+
+                // Merge `carry` with every occupied slot, like propagating a carry in binary addition
+                for (i = 0; runs[i] != nullptr; i++) {
+                    carry = _merge_sort_merge(runs[i], carry, comp);
+                    runs[i] = nullptr;
+                }
+                runs[i] = carry;
             }
 
-            if (second_half == nullptr) {
-                return first_half;
+            // Merge the remaining runs from the latest (lowest slot) to the earliest (highest slot)
+            carry = nullptr;
+            for (i = 0; i < std::numeric_limits<size_type>::digits; i++) {
+                if (runs[i] != nullptr) {
+                    carry = _merge_sort_merge(runs[i], carry, comp);
+                }
             }
 
-            // Compare the values between `first_half` and `second_half`
-            if (comp(first_half->value, second_half->value)) {
-                // Recursively merge the rest of the lists and link the result to the current node
-                first_half->next = _merge_sort_merge(first_half->next, second_half, comp);
-                return first_half;
+            return carry;
+        }
+
+        // Number of segments a parallel algorithm cuts the list into: at most `max_count`, each holding enough nodes
+        // to be worth a task of its own
+        [[nodiscard]] size_type _segment_count(size_type max_count) const noexcept {
+            // Below this many nodes per task, starting the task costs more than it saves
+            constexpr size_type min_nodes_per_segment = 1 << 14;
+
+            return std::max<size_type>(std::min(max_count, this->sz / min_nodes_per_segment), 1);
+        }
+
+        // Length of segment `i` out of `count` segments of (almost) equal length covering the list
+        [[nodiscard]] size_type _segment_length(size_type i, size_type count) const noexcept {
+            return this->sz / count + (i < this->sz % count);
+        }
+
+        // First node of each of `count` (<= size()) segments of (almost) equal length covering the list, found in a
+        // single pass
+        [[nodiscard]] std::vector<_Node*> _segment_starts(size_type count) const {
+            std::vector<_Node*> starts(count);
+            _Node* node = this->head->next;
+
+            for (size_type i = 0; i < count; i++) {
+                starts[i] = node;
+
+                for (size_type j = this->_segment_length(i, count); j > 0; j--) {
+                    node = node->next;
+                }
             }
 
-            // Recursively merge the rest of the lists and link the result to the current node
-            second_half->next = _merge_sort_merge(first_half, second_half->next, comp);
-            return second_half;
+            return starts;
         }
 
-        template<class Compare>
-        static constexpr _Node* _merge_sort(_Node* first_half, Compare comp) noexcept {
-            // Base case
-            if (first_half == nullptr || first_half->next == nullptr) {
-                return first_half;
+        // Runs `task(i, first, length)` through `executor` on each segment `i` out of `count` (from _segment_count())
+        // segments of the list, where `first` is the segment's first node and `length` its number of nodes. A single
+        // segment runs on the calling thread
+        template<class Executor, class Task>
+        void _for_each_segment(Executor& executor, size_type count, Task task) const {
+            if (count == 1) {
+                task(size_type(0), this->head->next, this->sz);
+                return;
+            }
+
+            const std::vector<_Node*> starts = this->_segment_starts(count);
+            executor.bulk_execute(count, [&](size_type i) -> void {
+                task(i, starts[i], this->_segment_length(i, count));
+            });
+        }
+
+        template<class Executor, class Compare>
+        void _parallel_sort(Executor& executor, Compare comp, size_type thread_count) {
+            thread_count = this->_segment_count(thread_count);
+            if (thread_count == 1) {
+                this->sort(comp);
+                return;
             }
 
-            // Split the list in half
-            _Node* second_half = _merge_sort_split(first_half);
+            // Allocate before any node is relinked, so that nothing can throw once the list is cut into runs
+            std::vector<std::pair<_Node*, _Node*>> runs(thread_count);
+
+            // Cut the chain into `thread_count` detached runs of (almost) equal length, in list order
+            _Node* node = this->head->next;
+            for (size_type i = 0; i < thread_count; i++) {
+                const size_type length = this->_segment_length(i, thread_count);
+
+                runs[i].first = node;
+                for (size_type j = 1; j < length; j++) {
+                    node = node->next;
+                }
+                runs[i].second = node;
+
+                node = node->next;
+                runs[i].second->next = nullptr;
+            }
 
-            // Recursively sort each half
-            first_half = _merge_sort(first_half, comp);
-            second_half = _merge_sort(second_half, comp);
+            // Sort every run on its own thread, keeping track of its last node
+            executor.bulk_execute(thread_count, [&](size_type i) -> void {
+                _Node* first = _merge_sort(runs[i].first, comp);
+                _Node* last = first;
+                while (last->next != nullptr) {
+                    last = last->next;
+                }
 
-            // Merge the two sorted halves
-            return _merge_sort_merge(first_half, second_half, comp);
+                runs[i] = {first, last};
+            });
+
+            // Merge adjacent runs pairwise, halving their number each round: the merge of runs[i] and runs[i + stride]
+            // lands in runs[i]. The earlier run is always the first half of a merge, which keeps the sort stable
+            for (size_type stride = 1; stride < thread_count; stride *= 2) {
+                executor.bulk_execute((thread_count - stride + 2 * stride - 1) / (2 * stride), [&](size_type pair) -> void {
+                    const size_type i = 2 * stride * pair;
+                    auto [first_half, first_last] = runs[i];
+                    auto [second_half, second_last] = runs[i + stride];
+
+                    // On ties the first half's nodes come first, so its last node only ends the merge if it is greater
+                    _Node* last = comp(second_last->value, first_last->value) ? first_last : second_last;
+                    runs[i] = {_merge_sort_merge(first_half, second_half, comp), last};
+                });
+            }
+
+            this->head->next = runs[0].first;
+            this->tail = runs[0].second;
         }
 
         template<class Compare>
@@ -319,9 +915,12 @@ namespace adt {
             }
 
             _Node* node = this->head->next;
+            _Prefetcher<prefetch_distance> prefetcher(node);
 
             // While there are two consecutive nodes to be traversed...
             while (node != nullptr && node->next != nullptr) {
+                prefetcher.step();
+
                 // If the two consecutive nodes are not comparable..
                 if (!comp(node->value, node->next->value)) {
                     return false;
@@ -395,41 +994,49 @@ namespace adt {
                 return *this;
             }
 
-            [[nodiscard]] const_reference operator*() const {
-                if (this->node == nullptr) {
-                    throw std::runtime_error("segmentation fault");
+            [[nodiscard]] constexpr const_reference operator*() const noexcept(!Checked) {
+                if constexpr (Checked) {
+                    if (this->node == nullptr) {
+                        throw std::runtime_error("segmentation fault");
+                    }
                 }
                 return this->node->value;
             }
 
-            [[nodiscard]] const_pointer operator->() const {
-                if (this->node == nullptr) {
-                    throw std::runtime_error("segmentation fault");
+            [[nodiscard]] constexpr const_pointer operator->() const noexcept(!Checked) {
+                if constexpr (Checked) {
+                    if (this->node == nullptr) {
+                        throw std::runtime_error("segmentation fault");
+                    }
                 }
                 return &(this->node->value);
             }
 
-            const_iterator& operator++() {
-                if (this->node == nullptr) {
-                    throw std::runtime_error("segmentation fault");
+            constexpr const_iterator& operator++() noexcept(!Checked) {
+                if constexpr (Checked) {
+                    if (this->node == nullptr) {
+                        throw std::runtime_error("segmentation fault");
+                    }
                 }
 
                 this->node = this->node->next;
                 return *this;
             }
 
-            const_iterator operator++(int) {
+            constexpr const_iterator operator++(int) noexcept(!Checked) {
                 const_iterator temp = *this;
                 ++(*this);
                 return temp;
             }
 
-            [[nodiscard]] const_iterator operator+(size_type n) const {
+            [[nodiscard]] constexpr const_iterator operator+(size_type n) const noexcept(!Checked) {
                 const _Node* curr = this->node;
 
                 for (size_type i = 0; i < n; i++) {
-                    if (curr == nullptr) {
-                        throw std::runtime_error("segmentation fault");
+                    if constexpr (Checked) {
+                        if (curr == nullptr) {
+                            throw std::runtime_error("segmentation fault");
+                        }
                     }
 
                     curr = curr->next;
@@ -438,10 +1045,12 @@ namespace adt {
                 return const_iterator(this->parent, curr);
             }
 
-            const_iterator& operator+=(size_type n) {
+            constexpr const_iterator& operator+=(size_type n) noexcept(!Checked) {
                 for (size_type i = 0; i < n; i++) {
-                    if (this->node == nullptr) {
-                        throw std::runtime_error("segmentation fault");
+                    if constexpr (Checked) {
+                        if (this->node == nullptr) {
+                            throw std::runtime_error("segmentation fault");
+                        }
                     }
 
                     this->node = this->node->next;
@@ -525,43 +1134,51 @@ namespace adt {
                 return *this;
             }
 
-            [[nodiscard]] reference operator*() const {
-                if (this->node == nullptr) {
-                    throw std::runtime_error("segmentation fault");
+            [[nodiscard]] constexpr reference operator*() const noexcept(!Checked) {
+                if constexpr (Checked) {
+                    if (this->node == nullptr) {
+                        throw std::runtime_error("segmentation fault");
+                    }
                 }
                 
                 return this->node->value;
             }
 
-            [[nodiscard]] pointer operator->() const {
-                if (this->node == nullptr) {
-                    throw std::runtime_error("segmentation fault");
+            [[nodiscard]] constexpr pointer operator->() const noexcept(!Checked) {
+                if constexpr (Checked) {
+                    if (this->node == nullptr) {
+                        throw std::runtime_error("segmentation fault");
+                    }
                 }
 
                 return &(this->node->value);
             }
 
-            iterator& operator++() {
-                if (this->node == nullptr) {
-                    throw std::runtime_error("segmentation fault");
+            constexpr iterator& operator++() noexcept(!Checked) {
+                if constexpr (Checked) {
+                    if (this->node == nullptr) {
+                        throw std::runtime_error("segmentation fault");
+                    }
                 }
                 
                 this->node = this->node->next;
                 return *this;
             }
 
-            iterator operator++(int) {
+            constexpr iterator operator++(int) noexcept(!Checked) {
                 iterator temp = *this;
                 ++(*this);
                 return temp;
             }
 
-            [[nodiscard]] iterator operator+(size_type n) const {
+            [[nodiscard]] constexpr iterator operator+(size_type n) const noexcept(!Checked) {
                 _Node* curr = this->node;
 
                 for (size_type i = 0; i < n; i++) {
-                    if (curr == nullptr) {
-                        throw std::runtime_error("segmentation fault");
+                    if constexpr (Checked) {
+                        if (curr == nullptr) {
+                            throw std::runtime_error("segmentation fault");
+                        }
                     }
                     
                     curr = curr->next;
@@ -570,10 +1187,12 @@ namespace adt {
                 return iterator(this->parent, curr);
             }
 
-            iterator& operator+=(size_type n) {
+            constexpr iterator& operator+=(size_type n) noexcept(!Checked) {
                 for (size_type i = 0; i < n; i++) {
-                    if (this->node == nullptr) {
-                        throw std::runtime_error("segmentation fault");
+                    if constexpr (Checked) {
+                        if (this->node == nullptr) {
+                            throw std::runtime_error("segmentation fault");
+                        }
                     }
                     this->node = this->node->next;
                 }
@@ -594,9 +1213,7 @@ namespace adt {
             [[nodiscard]] constexpr auto operator<=>(std::nullptr_t) const noexcept { return this->node <=> nullptr; }
 
             [[nodiscard]] constexpr operator const_iterator() const noexcept {
-                const_iterator cit;
-                cit.node = this->node;
-                return cit;
+                return const_iterator(this->parent, this->node);
             }
 
         };
@@ -757,123 +1374,118 @@ namespace adt {
 
         friend class iterator;
 
+        // Shares the node layout and hands its chains over to a singly_list
+        template<class, class>
+        friend class concurrent_singly_list;
+
+        // Shares the node layout
+        template<class, class>
+        friend class mpmc_list_queue;
+
+        // Splits its list in two for thieves
+        template<class, class>
+        friend class work_stealing_list;
+
+        // Sizes its inline buffer after the nodes and moves chains that mix inline and allocated nodes
+        template<class, std::size_t, class>
+        friend class small_singly_list;
+
     public:
         /* ----------------------------------------------Constructors----------------------------------------------- */
-        constexpr singly_list() noexcept : head(&dummy), sz(0) {}
-
-        constexpr singly_list(std::initializer_list<value_type> values) noexcept : head(&dummy), sz(values.size()) {
-            // For every value in `values`
-            _Node* node = this->head;
-            for (const_reference value : values) {
-                // Create a node to store `value`
-                node->next = this->_create_node(value);
-                
-                // Go to the next node
-                node = node->next;
-            }
-        }
+        constexpr singly_list() noexcept : head(&dummy), tail(&dummy), sz(0) {}
+
+        constexpr singly_list(std::initializer_list<value_type> values) noexcept
+            : singly_list(values, allocator_type()) {}
 
         constexpr singly_list(std::initializer_list<value_type> values, const allocator_type& allocator) noexcept
-            : singly_list(values) { this->allocator = allocator; }
+            : head(&dummy), tail(&dummy), allocator(allocator), node_allocator(allocator), sz(0) {
+            this->_insert_range_after(this->head, values.begin(), values.end());
+        }
 
-        explicit constexpr singly_list(size_type size) noexcept : head(&dummy), sz(size) {
-            // Create `size` nodes
-            _Node* node = this->head;
-            for (size_type i = 0; i < size; i++) {
-                node->next = this->_create_node(value_type());
-                node = node->next;
-            }
+        explicit constexpr singly_list(size_type size) noexcept : head(&dummy), tail(&dummy), sz(0) {
+            // Create `size` value-initialized nodes
+            this->_insert_chain_after(this->head, size, [this](_Node* node) -> void { this->_construct_node(node); });
         }
 
         explicit constexpr singly_list(const allocator_type& allocator) noexcept 
-            : head(&dummy), sz(0), allocator(allocator) {}
+            : head(&dummy), tail(&dummy), allocator(allocator), node_allocator(allocator), sz(0) {}
 
         constexpr singly_list(const singly_list& other) noexcept 
-            : head(&dummy), allocator(other.allocator), sz(other.sz) {
-            _Node* this_curr = this->head;
+            : singly_list(other, allocator_traits::select_on_container_copy_construction(other.allocator)) {}
+
+        constexpr singly_list(const singly_list& other, const allocator_type& allocator) noexcept 
+            : head(&dummy), tail(&dummy), allocator(allocator), node_allocator(allocator), sz(other.sz) {
             _Node* other_curr = other.head;
+            _Prefetcher<prefetch_distance> prefetcher(other.head->next);
 
             // For every node in `other`
             while (other_curr->next != nullptr) {
+                prefetcher.step();
+
                 // Copy the current node
-                this_curr->next = this->_create_node(other_curr->next->value);
+                this->tail->next = this->_create_node(other_curr->next->value);
                     
                 // Go to the next node
                 other_curr = other_curr->next;
-                this_curr = this_curr->next;
+                this->tail = this->tail->next;
             }
         }
 
-        constexpr singly_list(const singly_list& other, const allocator_type& allocator) noexcept 
-            : singly_list(other) { this->allocator = allocator; }
-
+        // Steals the nodes of `other` without allocating; `other` keeps a copy of its allocator so it stays usable
         constexpr singly_list(singly_list&& other) noexcept
-            : head(&dummy), allocator(other.allocator), sz(other.sz) {
-            this->head->next = other.head->next;
-            other.head->next = nullptr;
-            
-            other.sz = 0;
-            other.allocator = allocator_type();
+            : head(&dummy), tail(&dummy), allocator(other.allocator), node_allocator(other.node_allocator), sz(0) {
+            this->_steal(other);
         }
 
-        constexpr singly_list(singly_list&& other, const allocator_type& allocator) noexcept : singly_list(other) {
-            this->allocator = allocator;
+        // Steals the nodes of `other` if `allocator` can free them, otherwise moves its elements one by one into nodes
+        // allocated with `allocator`. Either way, `other` is left empty
+        constexpr singly_list(singly_list&& other, const allocator_type& allocator) noexcept
+            : head(&dummy), tail(&dummy), allocator(allocator), node_allocator(allocator), sz(0) {
+            if (this->_is_allocator_equal(other)) {
+                this->_steal(other);
+            } else {
+                this->_move_elements(other);
+            }
         }
 
         template<std::input_iterator InputIt>
-        constexpr singly_list(InputIt first, InputIt last) noexcept : head(&dummy), sz(0) {
-            // For each iterator
-            _Node* node = this->head;
-            for (InputIt it = first; it != last; it++) {
-                // Create a new node to store the value at the current iterator
-                node->next = this->_create_node(*it);
-                
-                // Update the size counter
-                this->sz++;
-
-                // Go to the next node
-                node = node->next;
-            }
-        }
+        constexpr singly_list(InputIt first, InputIt last) noexcept : singly_list(first, last, allocator_type()) {}
 
         template<std::input_iterator InputIt>
         constexpr singly_list(InputIt first, InputIt last, const allocator_type& allocator) noexcept 
-            : singly_list(first, last) { this->allocator = allocator; }
+            : head(&dummy), tail(&dummy), allocator(allocator), node_allocator(allocator), sz(0) {
+            this->_insert_range_after(this->head, first, last);
+        }
 
         template<class R> 
         constexpr singly_list(std::from_range_t, R&& range, const allocator_type& allocator = allocator_type()) 
             noexcept requires (std::convertible_to<std::ranges::range_reference_t<R>, value_type> && 
-                               std::ranges::input_range<R>) : head(&dummy), allocator(allocator), sz(0) {
-            _Node* curr = this->head;
-            for (auto value : range) {
-                curr->next = this->_create_node(value);
-                curr = curr->next;
-                this->sz++;
-            }
+                               std::ranges::input_range<R>)
+            : head(&dummy), tail(&dummy), allocator(allocator), node_allocator(allocator), sz(0) {
+            this->_insert_range_after(this->head, std::ranges::begin(range), std::ranges::end(range));
         }
 
-        singly_list(size_type size, const_reference value) : head(&dummy) {
-            if (size > 0) {
-                this->sz = size;
-                this->allocator = allocator;
+        singly_list(size_type size, const_reference value) : singly_list(size, value, allocator_type()) {}
 
+        singly_list(size_type size, const_reference value, const allocator_type& allocator)
+            : head(&dummy), tail(&dummy), allocator(allocator), node_allocator(allocator), sz(0) {
+            if (size > 0) {
                 // Create `size` nodes all initialized to `value`
-                _Node* node = this->head;
-                for (size_type i = 0; i < size; i++) {
-                    node->next = this->_create_node(value);
-                    node = node->next;
-                }
+                this->_insert_chain_after(this->head, size, [&](_Node* node) -> void {
+                    this->_construct_node(node, value);
+                });
 
                 return;
             }
             throw std::invalid_argument("\"size\" must exceed 0");
         }
 
-        singly_list(size_type size, const_reference value, const allocator_type& allocator)
-            : singly_list(size, value) { this->allocator = allocator; }
-
         /* -----------------------------------------------Destructor------------------------------------------------ */
         constexpr ~singly_list() noexcept {
+            // Nothing can reuse the nodes anymore
+            this->free_capacity = 0;
+            this->_release_free_nodes();
+
             this->_clear();
             this->head->next = nullptr;
             this->sz = 0;
@@ -882,44 +1494,102 @@ namespace adt {
         /* ------------------------------------------Overloaded Operators------------------------------------------- */
         constexpr singly_list& operator=(const singly_list& rhs) noexcept {
             // Protect against self-assignment
-            if (this != &rhs) {
-                // Free all nodes except the head
-                this->_clear();
+            if (this == &rhs) {
+                return *this;
+            }
 
-                // Copy the list from `rhs`
-                _Node* lhs_curr = this->head,
-                     * rhs_curr = rhs.head;
-                
-                while (rhs_curr->next != nullptr) {
-                    lhs_curr->next = this->_create_node(rhs_curr->next->value);
-                    
-                    lhs_curr = lhs_curr->next;
-                    rhs_curr = rhs_curr->next;
+            if constexpr (allocator_traits::propagate_on_container_copy_assignment::value) {
+                // Nodes from our allocator cannot be kept if the allocator of `rhs` is about to replace it
+                if (!this->_is_allocator_equal(rhs)) {
+                    this->_clear();
+                    this->_release_free_nodes();
+                    this->sz = 0;
                 }
 
-                this->sz = rhs.sz;
                 this->allocator = rhs.allocator;
+                this->node_allocator = rhs.node_allocator;
             }
-                
+
+            // Overwrite the values of the nodes both lists have
+            _Node* prev = this->head;
+            const _Node* rhs_node = rhs.head->next;
+            _Prefetcher<prefetch_distance> prefetcher(rhs.head->next);
+            size_type count = 0;
+
+            for (; rhs_node != nullptr && prev->next != nullptr; rhs_node = rhs_node->next) {
+                prefetcher.step();
+
+                prev->next->value = rhs_node->value;
+                prev = prev->next;
+                count++;
+            }
+
+            if (rhs_node != nullptr) {
+                // Copy the rest of `rhs` into new nodes after the tail, `prev`
+                this->_insert_chain_after(prev, rhs.sz - count, [&](_Node* node) -> void {
+                    this->_construct_node(node, rhs_node->value);
+                    rhs_node = rhs_node->next;
+                });
+            } else {
+                // Delete the nodes left over
+                this->_truncate_after(prev, count);
+            }
+
             return *this;
         }
 
-        constexpr singly_list& operator=(singly_list&& rhs) noexcept {
-            // Delete all nodes except the head
-            this->_clear();
+        constexpr singly_list& operator=(singly_list&& rhs) 
+            noexcept(allocator_traits::propagate_on_container_move_assignment::value ||
+                     allocator_traits::is_always_equal::value) {
+            // Protect against self-assignment
+            if (this == &rhs) {
+                return *this;
+            }
 
-            // Move the nodes from `rhs` to `*this`
-            this->head->next = rhs.head->next;
-            rhs.head->next = nullptr;
+            // Delete all nodes except the head (with the allocator that created them)
+            this->_clear();
+            this->sz = 0;
 
-            this->sz = rhs.sz;
-            rhs.sz = 0;
+            if constexpr (allocator_traits::propagate_on_container_move_assignment::value) {
+                // Take over the allocator of `rhs` along with its nodes, freeing the cached nodes of the old one
+                this->_release_free_nodes();
+                this->allocator = rhs.allocator;
+                this->node_allocator = rhs.node_allocator;
+                this->_steal(rhs);
+            } else if (this->_is_allocator_equal(rhs)) {
+                this->_steal(rhs);
+            } else {
+                // The nodes of `rhs` cannot be freed by our allocator, so only their values can move
+                this->_move_elements(rhs);
+            }
                 
             return *this;
         }
 
-        [[nodiscard]] constexpr bool operator==(const singly_list& rhs) const noexcept {
-            return std::equal(iterator(*this), iterator(nullptr), iterator(rhs), iterator(nullptr));
+        [[nodiscard]] constexpr bool operator==(const singly_list& rhs) const noexcept {
+            if (this->sz != rhs.sz) {
+                return false;
+            }
+
+            const _Node* node = this->head->next,
+                      * rhs_node = rhs.head->next;
+            _Prefetcher<prefetch_distance> prefetcher(node),
+                                           rhs_prefetcher(rhs_node);
+
+            // Both lists have the same size, so they run out of nodes together
+            while (node != nullptr) {
+                prefetcher.step();
+                rhs_prefetcher.step();
+
+                if (!(node->value == rhs_node->value)) {
+                    return false;
+                }
+
+                node = node->next;
+                rhs_node = rhs_node->next;
+            }
+
+            return true;
         }
 
         template<class R> 
@@ -966,64 +1636,39 @@ namespace adt {
 
         [[nodiscard]] constexpr iterator end() const noexcept { return iterator(this, nullptr); }
 
+        // The assign() overloads overwrite the values of the existing nodes in place, create only the nodes missing and
+        // delete only the nodes left over. Assigning as many elements as the list holds never allocates
         constexpr void assign(size_type count, const_reference value) noexcept {
-            _Node* curr = this->head;
-            for (size_type i = 0; i < count; i++) {
-                if (curr->next != nullptr) {
-                    curr->next->value = value;
-                } else {
-                    curr->next = this->_create_node(value);
-                    this->sz++;
-                }
-                curr = curr->next;
-            }
-        }
-
-        template<std::input_iterator InputIt>
-        constexpr void assign(InputIt first, InputIt last)  noexcept {
             _Node* prev = this->head;
-            for (InputIt it = first; it != last; ++it) {
-                // If there are more nodes in the list...
-                if (prev->next != nullptr) {
-                    // Overwrite the current node's value with `*it`
-                    prev->next->value = *it;
-                } else {
-                    // Create a new node initialized with `*it`
-                    prev->next = this->_create_node(*it);
-                    this->sz++;
-                }
+            size_type i = 0;
+
+            for (; i < count && prev->next != nullptr; i++) {
+                prev->next->value = value;
                 prev = prev->next;
             }
+
+            if (i < count) {
+                // `prev` is the tail
+                this->_insert_chain_after(prev, count - i, [&](_Node* node) -> void {
+                    this->_construct_node(node, value);
+                });
+            } else {
+                this->_truncate_after(prev, count);
+            }
         }
 
+        template<std::input_iterator InputIt>
+        constexpr void assign(InputIt first, InputIt last)  noexcept { this->_assign_range(first, last); }
+
         constexpr void assign(std::initializer_list<value_type> values) noexcept {
-            _Node* curr = this->head;
-            for (const_reference value : values) {
-                if (curr->next != nullptr) {
-                    curr->next->value = value;
-                } else {
-                    curr->next = this->_create_node(value);
-                    this->sz++;
-                }
-                curr = curr->next;
-            }
+            this->_assign_range(values.begin(), values.end());
         }
 
         template<class R>
         constexpr void assign_range(R&& range) noexcept 
             requires (std::assignable_from<reference, std::ranges::range_reference_t<R>> &&
                       std::ranges::input_range<R>) {
-            _Node* curr = this->head;
-            for (auto value : range) {
-                if (curr->next != nullptr) {
-                    curr->next->value = value;
-                } else {
-                    curr->next = this->_create_node(value);
-                    this->sz++;
-                }
-
-                curr = curr->next;
-            }
+            this->_assign_range(std::ranges::begin(range), std::ranges::end(range));
         }
 
         [[nodiscard]] constexpr allocator_type get_allocator() const noexcept { return this->allocator; }
@@ -1036,10 +1681,8 @@ namespace adt {
         }
 
         [[nodiscard]] constexpr reference back() const {
-            for (_Node* node = this->head->next; node != nullptr; node = node->next) {
-                if (node->next == nullptr) {
-                    return node->value;
-                }
+            if (this->head->next != nullptr) {
+                return this->tail->value;
             }
             throw std::runtime_error("segmentation fault");
         }
@@ -1058,6 +1701,23 @@ namespace adt {
             this->sz = 0;
         }
 
+        // Maximum number of erased nodes kept for the next insertions (0 when the node cache is disabled)
+        [[nodiscard]] constexpr size_type node_cache_capacity() const noexcept { return this->free_capacity; }
+
+        // Number of erased nodes currently kept for the next insertions
+        [[nodiscard]] constexpr size_type node_cache_size() const noexcept { return this->free_count; }
+
+        // Keeps the storage of up to `capacity` erased nodes (by clear(), erase_after(), remove_if(), unique(), a
+        // smaller resize(), ...) for the next insertions, so that a list cleared and refilled stops allocating. Nodes
+        // cached beyond the new capacity are freed; 0 disables the cache
+        constexpr void set_node_cache_capacity(size_type capacity) noexcept {
+            this->free_capacity = capacity;
+            this->_release_free_nodes(capacity);
+        }
+
+        // Frees every node kept by the node cache. The capacity is left unchanged
+        constexpr void shrink_to_fit() noexcept { this->_release_free_nodes(); }
+
         iterator insert_after(const_iterator pos, const_reference value)
             requires (std::is_copy_constructible_v<value_type>) {
             if (pos == nullptr) {
@@ -1073,7 +1733,7 @@ namespace adt {
             return iterator(this, this->_insert_after(const_cast<_Node*>(pos.node), value));
         }
 
-        iterator insert_after(const_iterator pos, reference& value) 
+        iterator insert_after(const_iterator pos, value_type&& value) 
             requires (std::is_move_constructible_v<value_type>) {
             if (pos == nullptr) {
                 throw std::runtime_error("segmentation fault");
@@ -1085,7 +1745,7 @@ namespace adt {
                 );
             }
 
-            return iterator(this, this->_insert_after(const_cast<_Node*>(pos.node), value));
+            return iterator(this, this->_insert_after(const_cast<_Node*>(pos.node), std::move(value)));
         }
 
         iterator insert_after(const_iterator pos, size_type count, const_reference value)
@@ -1108,9 +1768,7 @@ namespace adt {
                 return iterator(this, pos_node);
             }
 
-            for (size_type i = 0; i < count; i++) {
-                this->_insert_after(pos_node, value);
-            }
+            this->_insert_chain_after(pos_node, count, [&](_Node* node) -> void { this->_construct_node(node, value); });
 
             // Return an instance of `iterator` starting one node after `pos`
             return iterator(this, pos_node->next);
@@ -1129,14 +1787,7 @@ namespace adt {
             }
 
             // Cast away the `const`ness of the node at `pos`
-            _Node* pos_node = const_cast<_Node*>(pos.node);
-
-            for (InputIt input_it = first; input_it != last; ++input_it) {
-                this->_insert_after(pos_node, *input_it);
-                pos_node = pos_node->next;
-            }
-            
-            return iterator(this, pos_node);
+            return iterator(this, this->_insert_range_after(const_cast<_Node*>(pos.node), first, last));
         }
 
         iterator insert_after(const_iterator pos, std::initializer_list<value_type> values) {
@@ -1150,13 +1801,7 @@ namespace adt {
                 );
             }
 
-            _Node* pos_node = const_cast<_Node*>(pos.node);
-            for (const_reference value : values) {
-                this->_insert_after(pos_node, value);
-                pos_node = pos_node->next;
-            }
-
-            return iterator(this, pos_node);
+            return iterator(this, this->_insert_range_after(const_cast<_Node*>(pos.node), values.begin(), values.end()));
         }
 
         template<class R>
@@ -1174,14 +1819,8 @@ namespace adt {
             }
             
             // Cast away the `const`ness of the node at `pos`
-            _Node* pos_node = const_cast<_Node*>(pos.node);
-
-            for (auto value : range) {
-                this->_insert_after(pos_node, value);
-                pos_node = pos_node->next;
-            }
-
-            return iterator(this, pos_node);
+            return iterator(this, this->_insert_range_after(const_cast<_Node*>(pos.node),
+                                                            std::ranges::begin(range), std::ranges::end(range)));
         }
 
         template<class... Args>
@@ -1197,19 +1836,8 @@ namespace adt {
                 );
             }
 
-            _Node* pos_node = const_cast<_Node*>(pos.node);
-
-            // Save a copy of the next node after `pos_node`
-            _Node* next = pos_node->next;
-
-            // Create a new node
-            pos_node->next = this->_create_node(value_type(std::forward<Args>(args)...), next);
-                
-            // Update the size counter
-            this->sz++;
-
-            // Return an iterator to the node after `pos_node`
-            return iterator(this, pos_node->next);
+            // Construct the new node's value in place and return an iterator to it
+            return iterator(this, this->_insert_after(const_cast<_Node*>(pos.node), std::forward<Args>(args)...));
         }
     
         iterator erase_after(const_iterator pos) {
@@ -1402,29 +2030,19 @@ namespace adt {
 
         constexpr void push_back(const_reference value) noexcept
             requires(std::is_copy_constructible_v<value_type>) {
-            // Get to the current tail of the list
-            _Node* tail = this->head;
-            while (tail->next != nullptr) {
-                tail = tail->next;
-            }
-
             // Create a new node and append it to the list
-            tail->next = this->_create_node(value);
+            this->tail->next = this->_create_node(value);
+            this->tail = this->tail->next;
             
             // Update the size counter
             this->sz++;
         }
 
-        constexpr void push_back(reference& value) noexcept
+        constexpr void push_back(value_type&& value) noexcept
             requires(std::is_move_constructible_v<value_type>) {
-            // Get to the current tail of the list
-            _Node* tail = this->head;
-            while (tail->next != nullptr) {
-                tail = tail->next;
-            }
-
             // Create a new node and append it to the list
-            tail->next = this->_create_node(std::forward<value_type>(value));
+            this->tail->next = this->_create_node(std::move(value));
+            this->tail = this->tail->next;
             
             // Update the size counter
             this->sz++;
@@ -1435,35 +2053,41 @@ namespace adt {
             _Node* new_front = this->_create_node(value, this->head->next);
             this->head->next = new_front;
 
+            // If the list was empty, the new front is also the tail
+            if (this->tail == this->head) {
+                this->tail = new_front;
+            }
+
             this->sz++;
         }
 
-        constexpr void push_front(reference& value) noexcept
+        constexpr void push_front(value_type&& value) noexcept
             requires(std::is_move_constructible_v<value_type>) {
-            this->head->next = this->_create_node(std::forward<value_type>(value), this->head->next);
+            this->head->next = this->_create_node(std::move(value), this->head->next);
+            if (this->tail == this->head) {
+                this->tail = this->head->next;
+            }
             this->sz++;
         }
 
         template<class... Args>
         constexpr reference emplace_back(Args&&... args) noexcept {
-            // Get to the tail of the list
-            _Node* tail = this->head;
-            while (tail->next != nullptr) {
-                tail = tail->next;
-            }
-
             // Create a new node after the tail
-            tail->next = this->_create_node(value_type(std::forward<Args>(args)...));
+            this->tail->next = this->_emplace_node(nullptr, std::forward<Args>(args)...);
+            this->tail = this->tail->next;
             
             // Update the size counter
             this->sz++;
 
-            return tail->next->value;
+            return this->tail->value;
         }
 
         template<class... Args>
         constexpr reference emplace_front(Args&&... args) noexcept {
-            this->head->next = this->_create_node(value_type(std::forward<Args>(args)...), this->head->next);
+            this->head->next = this->_emplace_node(this->head->next, std::forward<Args>(args)...);
+            if (this->tail == this->head) {
+                this->tail = this->head->next;
+            }
             this->sz++;
 
             return this->head->next->value;
@@ -1473,26 +2097,13 @@ namespace adt {
         constexpr void prepend_range(R&& range) noexcept
             requires (std::convertible_to<std::ranges::range_reference_t<R>, value_type> && 
                       std::ranges::input_range<R>) {
-            _Node* node = this->head;
-            for (auto value : range) {
-                this->_insert_after(node, value);
-                node = node->next;
-            }
+            this->_insert_range_after(this->head, std::ranges::begin(range), std::ranges::end(range));
         }
 
         template<class R>
         requires (std::convertible_to<std::ranges::range_reference_t<R>, value_type> && std::ranges::input_range<R>)
         constexpr void append_range(R&& range) noexcept {
-            // Get to the end of the list
-            _Node* node = this->head;
-            while (node->next != nullptr) {
-                node = node->next;
-            }
-            
-            for (auto value : range) {
-                this->_insert_after(node, value);
-                node = node->next;
-            }
+            this->_insert_range_after(this->tail, std::ranges::begin(range), std::ranges::end(range));
         }
 
         void pop_back() {
@@ -1506,6 +2117,7 @@ namespace adt {
 
                 // Delete the tail node
                 node->next = this->_delete_node(node->next);
+                this->tail = node;
                 
                 // Update the size counter
                 this->sz--;
@@ -1523,9 +2135,15 @@ namespace adt {
                 // Overwrite the front node with the node after it
                 this->head->next = this->head->next->next;
 
+                // If the old front was the tail, the list is now empty. Checked before the node is freed, since a
+                // pointer to a freed node must not even be compared
+                if (node == this->tail) {
+                    this->tail = this->head;
+                }
+
                 // Delete the copy of the old front node
                 this->_delete_node(node);
-                
+
                 // Update the size counter
                 this->sz--;
             } else {
@@ -1546,9 +2164,12 @@ namespace adt {
             size_type vals_removed = 0;
             _Node* prev = this->head,
                  * next;
+            _Prefetcher<prefetch_distance> prefetcher(prev->next);
             
             // While the end of the list has NOT been reached...
             while (prev != nullptr && prev->next != nullptr) {
+                prefetcher.step();
+
                 // If the current node's value equals `value`...
                 if (prev->next->value == value) {
                     // Remove the node from the list
@@ -1568,6 +2189,9 @@ namespace adt {
                 prev = prev->next;
             }
 
+            // `prev` is now the last node in the list
+            this->tail = prev;
+
             return vals_removed;
         }
 
@@ -1582,9 +2206,12 @@ namespace adt {
             size_type vals_removed = 0;
             _Node* prev = this->head,
                  * next;
+            _Prefetcher<prefetch_distance> prefetcher(prev->next);
 
             // While the end of the list has NOT been reached...
             while (prev != nullptr && prev->next != nullptr) {
+                prefetcher.step();
+
                 // If the predicate `pred` returns true for the current node's value...
                 if (pred(prev->next->value)) {
                     // Remove the current node
@@ -1604,19 +2231,273 @@ namespace adt {
                 prev = prev->next;
             }
 
+            // `prev` is now the last node in the list
+            this->tail = prev;
+
+            return vals_removed;
+        }
+
+        // Calls `f` on every element in order, prefetching `Distance` nodes ahead of the element being visited
+        template<size_type Distance = prefetch_distance, class UnaryFunction>
+        constexpr UnaryFunction for_each(UnaryFunction f) requires (std::invocable<UnaryFunction&, reference>) {
+            _Prefetcher<Distance> prefetcher(this->head->next);
+
+            for (_Node* node = this->head->next; node != nullptr; node = node->next) {
+                prefetcher.step();
+                f(node->value);
+            }
+
+            return f;
+        }
+
+        template<size_type Distance = prefetch_distance, class UnaryFunction>
+        constexpr UnaryFunction for_each(UnaryFunction f) const 
+            requires (std::invocable<UnaryFunction&, const_reference>) {
+            _Prefetcher<Distance> prefetcher(this->head->next);
+
+            for (const _Node* node = this->head->next; node != nullptr; node = node->next) {
+                prefetcher.step();
+                f(static_cast<const_reference>(node->value));
+            }
+
+            return f;
+        }
+
+        // Calls `f` on every element as tasks of `executor` (e.g. adt::execution::par), each task visiting a segment of
+        // consecutive elements. `f` is called concurrently, on distinct elements
+        template<execution::executor Executor, class UnaryFunction>
+        void for_each(Executor&& executor, UnaryFunction f) requires (std::invocable<UnaryFunction&, reference>) {
+            this->_for_each_segment(executor, this->_segment_count(executor.concurrency()),
+                                    [&](size_type, _Node* node, size_type length) -> void {
+                for (; length > 0; length--, node = node->next) {
+                    f(node->value);
+                }
+            });
+        }
+
+        template<execution::executor Executor, class UnaryFunction>
+        void for_each(Executor&& executor, UnaryFunction f) const
+            requires (std::invocable<UnaryFunction&, const_reference>) {
+            this->_for_each_segment(executor, this->_segment_count(executor.concurrency()),
+                                    [&](size_type, const _Node* node, size_type length) -> void {
+                for (; length > 0; length--, node = node->next) {
+                    f(static_cast<const_reference>(node->value));
+                }
+            });
+        }
+
+        // Replaces every element with `op(element)`, as tasks of `executor`. `op` is called concurrently
+        template<execution::executor Executor, class UnaryOperation>
+        void transform_inplace(Executor&& executor, UnaryOperation op)
+            requires (std::is_assignable_v<reference, std::invoke_result_t<UnaryOperation&, const_reference>>) {
+            this->_for_each_segment(executor, this->_segment_count(executor.concurrency()),
+                                    [&](size_type, _Node* node, size_type length) -> void {
+                for (; length > 0; length--, node = node->next) {
+                    node->value = op(static_cast<const_reference>(node->value));
+                }
+            });
+        }
+
+        // Number of elements for which `pred` returns true, counted as tasks of `executor`. `pred` is called
+        // concurrently
+        template<execution::executor Executor, class Predicate>
+        [[nodiscard]] size_type count_if(Executor&& executor, Predicate pred) const
+            requires (std::predicate<Predicate&, const_reference>) {
+            const size_type count = this->_segment_count(executor.concurrency());
+            std::vector<size_type> counts(count);
+
+            this->_for_each_segment(executor, count, [&](size_type i, const _Node* node, size_type length) -> void {
+                size_type matches = 0;
+                for (; length > 0; length--, node = node->next) {
+                    matches += static_cast<bool>(pred(node->value));
+                }
+                counts[i] = matches;
+            });
+
+            return std::accumulate(counts.begin(), counts.end(), size_type(0));
+        }
+
+        // Folds every element into `init` with `op`, as tasks of `executor`: each task folds a segment, then the
+        // results are folded in list order. As with std::reduce, `op` must be associative and commutative, since
+        // elements are not grouped as in a left fold. Each segment starts from its first element converted to `U`, and
+        // the results are combined with `op(U, U)`. `op` is called concurrently
+        template<execution::executor Executor, class U, class BinaryOperation>
+        [[nodiscard]] U reduce(Executor&& executor, U init, BinaryOperation op) const
+            requires (std::convertible_to<const_reference, U> &&
+                      std::is_convertible_v<std::invoke_result_t<BinaryOperation&, U, const_reference>, U> &&
+                      std::is_convertible_v<std::invoke_result_t<BinaryOperation&, U, U>, U>) {
+            if (this->head->next == nullptr) {
+                return init;
+            }
+
+            const size_type count = this->_segment_count(executor.concurrency());
+            std::vector<std::optional<U>> partials(count);
+
+            this->_for_each_segment(executor, count, [&](size_type i, const _Node* node, size_type length) -> void {
+                U partial = node->value;
+                for (node = node->next, length--; length > 0; length--, node = node->next) {
+                    partial = op(std::move(partial), node->value);
+                }
+                partials[i].emplace(std::move(partial));
+            });
+
+            for (std::optional<U>& partial : partials) {
+                init = op(std::move(init), std::move(*partial));
+            }
+
+            return init;
+        }
+
+        // Removes every element for which `pred` returns true and returns how many were removed. Each task of
+        // `executor` evaluates `pred` on a segment and unlinks the matching nodes; the segments are then joined and
+        // the removed nodes freed on the calling thread, so the allocator is never used concurrently. `pred` is
+        // called concurrently
+        template<execution::executor Executor, class Predicate>
+        size_type remove_if(Executor&& executor, Predicate pred) requires (std::predicate<Predicate&, const_reference>) {
+            struct segment {
+                _Node* first_kept = nullptr;
+
+                _Node* last_kept = nullptr;
+
+                _Node* removed = nullptr;
+
+                size_type removed_count = 0;
+            };
+
+            const size_type count = this->_segment_count(executor.concurrency());
+            std::vector<segment> segments(count);
+
+            this->_for_each_segment(executor, count, [&](size_type i, _Node* node, size_type length) -> void {
+                segment& result = segments[i];
+
+                for (; length > 0; length--) {
+                    _Node* next = node->next;
+
+                    // Move the node to the segment's chain of removed nodes, or link it after the last kept one
+                    if (pred(static_cast<const_reference>(node->value))) {
+                        node->next = result.removed;
+                        result.removed = node;
+                        result.removed_count++;
+                    } else {
+                        if (result.last_kept == nullptr) {
+                            result.first_kept = node;
+                        } else {
+                            result.last_kept->next = node;
+                        }
+                        result.last_kept = node;
+                    }
+
+                    node = next;
+                }
+            });
+
+            // Join the kept nodes of every segment, in order
+            size_type vals_removed = 0;
+            _Node* prev = this->head;
+
+            for (segment& result : segments) {
+                if (result.first_kept != nullptr) {
+                    prev->next = result.first_kept;
+                    prev = result.last_kept;
+                }
+
+                for (_Node* node = result.removed; node != nullptr; ) {
+                    _Node* next = node->next;
+                    this->_delete_node(node);
+                    node = next;
+                }
+                vals_removed += result.removed_count;
+            }
+
+            prev->next = nullptr;
+            this->tail = prev;
+            this->sz -= vals_removed;
+
             return vals_removed;
         }
 
+        // Cuts the list into `count` segments of (almost) equal length in a single pass, e.g. to process them on
+        // separate threads. There are fewer segments when the list holds fewer than `count` elements, none when empty
+        [[nodiscard]] std::vector<std::ranges::subrange<iterator>> segments(size_type count) {
+            if (count == 0) {
+                throw std::invalid_argument("segments() error: \"count\" must exceed 0");
+            }
+
+            count = std::min(count, this->sz);
+            const std::vector<_Node*> starts = this->_segment_starts(count);
+            std::vector<std::ranges::subrange<iterator>> result;
+            result.reserve(count);
+
+            for (size_type i = 0; i < count; i++) {
+                result.emplace_back(iterator(this, starts[i]), iterator(this, (i + 1 < count) ? starts[i + 1] : nullptr));
+            }
+
+            return result;
+        }
+
+        [[nodiscard]] std::vector<std::ranges::subrange<const_iterator>> segments(size_type count) const {
+            if (count == 0) {
+                throw std::invalid_argument("segments() error: \"count\" must exceed 0");
+            }
+
+            count = std::min(count, this->sz);
+            const std::vector<_Node*> starts = this->_segment_starts(count);
+            std::vector<std::ranges::subrange<const_iterator>> result;
+            result.reserve(count);
+
+            for (size_type i = 0; i < count; i++) {
+                result.emplace_back(const_iterator(this, starts[i]),
+                                    const_iterator(this, (i + 1 < count) ? starts[i + 1] : nullptr));
+            }
+
+            return result;
+        }
+
+        // Exchanges the nodes of both lists in O(1). If the allocator propagates on swap, the allocators trade places
+        // along with the nodes they allocated, cached nodes included. Otherwise, if the allocators compare unequal,
+        // neither can free the nodes of the other, so the elements are moved across instead in O(n)
         constexpr void swap(singly_list& other) noexcept {
+            if (this == &other) {
+                return;
+            }
+
+            if constexpr (allocator_traits::propagate_on_container_swap::value) {
+                std::swap(this->allocator, other.allocator);
+                std::swap(this->node_allocator, other.node_allocator);
+
+                // The cached nodes follow their allocator, each list keeping its own cache capacity
+                std::swap(this->free_nodes, other.free_nodes);
+                std::swap(this->free_count, other.free_count);
+                this->_release_free_nodes(this->free_capacity);
+                other._release_free_nodes(other.free_capacity);
+            } else if (!this->_is_allocator_equal(other)) {
+                singly_list temp(std::move(*this));
+                this->_move_elements(other);
+                other._move_elements(temp);
+                return;
+            }
+
             _Node* temp = this->head->next;
             this->head->next = other.head->next;
             other.head->next = temp;
+
+            // Swap the tails, re-pointing an empty list's tail to its own head
+            temp = this->tail;
+            this->tail = (other.tail == other.head) ? this->head : other.tail;
+            other.tail = (temp == this->head) ? other.head : temp;
+
+            std::swap(this->sz, other.sz);
         }
 
         constexpr void reverse() noexcept {
             _Node* prev = nullptr,
                  * curr = this->head->next,
                  * next;
+
+            // The old front becomes the new tail
+            if (curr != nullptr) {
+                this->tail = curr;
+            }
             
             while (curr != nullptr) {
                 // Save a copy of the next node
@@ -1634,56 +2515,244 @@ namespace adt {
             this->head->next = prev;
         }
 
-        constexpr size_type unique() noexcept {
-            // Check if the list contains more than 1 node
-            if (this->head->next != nullptr && this->head->next->next != nullptr) {
-                std::unordered_set<value_type> seen;
-                size_type dups_removed = 0;
-                _Node* node = this->head,
-                     * dup;
+        constexpr size_type unique() noexcept { return this->unique(std::equal_to<value_type>{}); }
+
+        // Removes every element for which `pred(previous, element)` holds, `previous` being the element kept before it,
+        // in a single allocation-free pass. Returns the number of elements removed
+        template<class BinaryPredicate>
+        constexpr size_type unique(BinaryPredicate pred) noexcept 
+            requires (std::predicate<BinaryPredicate, const_reference, const_reference>) {
+            // Check if the list contains any node
+            if (this->head->next == nullptr) {
+                return 0;
+            }
+
+            size_type dups_removed = 0;
+            _Node* node = this->head->next,
+                 * dup;
+            _Prefetcher<prefetch_distance> prefetcher(node->next);
+
+            while (node->next != nullptr) {
+                prefetcher.step();
+
+                if (pred(node->value, node->next->value)) {
+                    // Skip past the duplicate and delete it
+                    dup = node->next;
+                    node->next = dup->next;
+                    this->_delete_node(dup);
+
+                    dups_removed++;
+                } else {
+                    // Go to the next node
+                    node = node->next;
+                }
+            }
 
-                do {
-                    if (seen.find(node->next->value) != seen.end()) {
-                        // Save a copy of the duplicate
-                        dup = node->next;
+            // `node` is now the last node in the list
+            this->tail = node;
+            this->sz -= dups_removed;
 
-                        // Skip past the duplicate
-                        node->next = node->next->next;
+            return dups_removed;
+        }
 
-                        // Delete the duplicate copy
-                        this->_delete_node(dup);
-                        
-                        // Update the size counter
-                        this->sz--;
+        // Removes every element equal to any element before it, wherever it is in the list, keeping the first
+        // occurrences in order. Runs in O(n) expected time with an open-addressing table of pointers to the kept
+        // elements, sized once from size(), so no element is copied or hashed into a node of its own. Returns the
+        // number of elements removed
+        template<class Hash = std::hash<value_type>, class KeyEqual = std::equal_to<value_type>>
+        size_type dedup_all(Hash hash = Hash(), KeyEqual equal = KeyEqual())
+            requires (std::is_invocable_r_v<std::size_t, Hash, const_reference> &&
+                      std::predicate<KeyEqual, const_reference, const_reference>) {
+            if (this->sz < 2) {
+                return 0;
+            }
 
-                        // Update the number of duplicates removed
-                        dups_removed++;
-                    } else {
-                        // Add the element to the seen set
-                        seen.insert(node->next->value);
+            using _SlotAllocator = typename allocator_traits::template rebind_alloc<const value_type*>;
 
-                        // Go to the next node
-                        node = node->next;
+            // Keep the load factor at or below 1/2 so that linear probing stays short
+            const size_type capacity = std::bit_ceil(this->sz * 2);
+            const int shift = 64 - std::countr_zero(capacity);
+            std::vector<const value_type*, _SlotAllocator> slots(capacity, nullptr, _SlotAllocator(this->allocator));
+
+            size_type dups_removed = 0;
+            _Node* node = this->head,
+                 * dup;
+            _Prefetcher<prefetch_distance> prefetcher(node->next);
+
+            while (node->next != nullptr) {
+                prefetcher.step();
+
+                const_reference value = node->next->value;
+
+                // Fibonacci hashing spreads poor hashes (e.g. the identity hash of integers) over the whole table
+                size_type slot = static_cast<size_type>(
+                    (static_cast<std::uint64_t>(hash(value)) * 0x9E3779B97F4A7C15ull) >> shift
+                );
+                bool is_dup = false;
+
+                while (slots[slot] != nullptr) {
+                    if (equal(*slots[slot], value)) {
+                        is_dup = true;
+                        break;
                     }
-                } while (node->next != nullptr);
+                    slot = (slot + 1) & (capacity - 1);
+                }
 
-                return dups_removed;
+                if (is_dup) {
+                    // Skip past the duplicate and delete it
+                    dup = node->next;
+                    node->next = dup->next;
+                    this->_delete_node(dup);
+
+                    dups_removed++;
+                } else {
+                    // Remember the element and go to the next node
+                    slots[slot] = &value;
+                    node = node->next;
+                }
+            }
+
+            // `node` is now the last node in the list
+            this->tail = node;
+            this->sz -= dups_removed;
+
+            return dups_removed;
+        }
+
+        // Same as dedup_all(), but tracks the elements kept in the caller's `seen` set (e.g. a std::unordered_set
+        // reserved beforehand), which is left holding a copy of every distinct element
+        template<class Set>
+        size_type dedup_all(Set& seen)
+            requires requires (Set& set, const_reference value) { 
+                { set.insert(value).second } -> std::convertible_to<bool>;
+            } {
+            size_type dups_removed = 0;
+            _Node* node = this->head,
+                 * dup;
+            _Prefetcher<prefetch_distance> prefetcher(node->next);
+
+            while (node->next != nullptr) {
+                prefetcher.step();
+
+                if (!seen.insert(node->next->value).second) {
+                    // Skip past the duplicate and delete it
+                    dup = node->next;
+                    node->next = dup->next;
+                    this->_delete_node(dup);
+
+                    dups_removed++;
+                } else {
+                    // Go to the next node
+                    node = node->next;
+                }
+            }
+
+            // `node` is now the last node in the list
+            this->tail = node;
+            this->sz -= dups_removed;
+
+            return dups_removed;
+        }
+
+        // Reallocates every node in traversal order and relinks them, so that iteration walks memory sequentially
+        // again after the nodes have been scattered by insertions, erasures, splices or sorting. With an allocator that
+        // provides allocate_contiguous() (e.g. adt::node_pool_allocator) the nodes end up in one contiguous block.
+        // Otherwise they are allocated one after the other before any old node is freed, and whether they end up
+        // adjacent depends on the allocator (a general-purpose heap recycles its freed chunks in no particular order).
+        // Elements are moved, so iterators, pointers and references into the list are invalidated
+        constexpr void compact() noexcept requires (std::is_move_constructible_v<value_type>) {
+            if (this->head->next == nullptr) {
+                return;
+            }
+
+            _Node* old_first = this->head->next,
+                 * old = old_first;
+
+            // Move every value into its new node, in traversal order
+            auto [first, last] = this->_create_chain<true>(this->sz, [&](_Node* node) -> void {
+                this->_construct_node(node, std::move(old->value));
+                old = old->next;
+            });
+            this->head->next = first;
+            this->tail = last;
+
+            // Only now free the old nodes, so that none of their memory was handed back out above
+            while (old_first != nullptr) {
+                _Node* next = old_first->next;
+                this->_delete_node(old_first);
+                old_first = next;
             }
-            
-            // 0 duplicates removed
-            return 0;
         }
 
-        constexpr void sort() noexcept { this->head->next = _merge_sort(this->head->next, std::less<value_type>{}); }
+        constexpr void sort() noexcept { this->sort(std::less<value_type>{}); }
 
         template<class Compare>
-        constexpr void sort(Compare comp) noexcept { this->head->next = _merge_sort(this->head->next, comp); }
+        constexpr void sort(Compare comp) noexcept requires (!execution::executor<Compare>) {
+            this->head->next = _merge_sort(this->head->next, comp);
+
+            // Find the new tail of the sorted list
+            while (this->tail->next != nullptr) {
+                this->tail = this->tail->next;
+            }
+        }
+
+        template<execution::executor Executor>
+        void sort(Executor&& executor) { this->sort(executor, std::less<value_type>{}); }
+
+        template<execution::executor Executor, class Compare>
+        void sort(Executor&& executor, Compare comp) { this->sort(executor, comp, executor.concurrency()); }
+
+        // Stable sort that cuts the list into up to `thread_count` runs of consecutive nodes, sorts them as separate
+        // tasks of `executor` (e.g. adt::execution::par) and merges them pairwise, also in parallel. Nodes are only
+        // relinked, never allocated; apart from the executor, the only allocation is an array of `thread_count`
+        // entries. `comp` is called concurrently. Lists too short to benefit are sorted on the calling thread
+        template<execution::executor Executor, class Compare>
+        void sort(Executor&& executor, Compare comp, size_type thread_count) {
+            this->_parallel_sort(executor, comp, thread_count);
+        }
 
         [[nodiscard]] constexpr bool is_sorted() const noexcept { return this->_is_sorted(std::less<value_type>{}); }
 
         template<class Compare>
         [[nodiscard]] constexpr bool is_sorted(Compare comp) const noexcept { return this->_is_sorted(comp); }
 
+        constexpr void merge(singly_list& other) noexcept { this->merge(other, std::less<value_type>{}); }
+
+        constexpr void merge(singly_list&& other) noexcept { this->merge(other, std::less<value_type>{}); }
+
+        // Merges the sorted list `other` into this sorted list in O(n + m) by relinking nodes, leaving `other` empty.
+        // The merge is stable: of equivalent elements, those already in `*this` come first
+        template<class Compare>
+        constexpr void merge(singly_list& other, Compare comp) noexcept {
+            if (this == &other || other.head->next == nullptr) {
+                return;
+            }
+
+            // If the allocators differ, the nodes of `other` cannot change owners, so merge a copy made with ours
+            if (!this->_is_allocator_equal(other)) {
+                singly_list temp(std::move(other), this->allocator);
+                this->merge(temp, comp);
+                return;
+            }
+
+            // The last node of the merged list is the last node of whichever list was exhausted last
+            _Node* new_tail = (this->head->next == nullptr || !comp(other.tail->value, this->tail->value)) 
+                ? other.tail
+                : this->tail;
+
+            this->head->next = _merge_sort_merge(this->head->next, other.head->next, comp);
+            this->tail = new_tail;
+            this->sz += other.sz;
+
+            // Leave `other` empty
+            other.head->next = nullptr;
+            other.tail = other.head;
+            other.sz = 0;
+        }
+
+        template<class Compare>
+        constexpr void merge(singly_list&& other, Compare comp) noexcept { this->merge(other, comp); }
+
         node_type extract_after(const_iterator pos) {
             if (pos == nullptr) {
                 throw std::runtime_error("segmentation fault");
@@ -1708,6 +2777,9 @@ namespace adt {
             _Node* pos_node = const_cast<_Node*>(pos.node);
 
             // Unlink the node after `pos` from the list
+            if (pos_node->next == this->tail) {
+                this->tail = pos_node;
+            }
             _Node* temp = pos_node->next->next;
             this->_delete_node(pos_node->next);
             pos_node->next = temp;
@@ -1722,23 +2794,21 @@ namespace adt {
 
 namespace std {
     
-    template<class T, class Allocator>
-    constexpr void swap(adt::singly_list<T, Allocator>& lhs, adt::singly_list<T, Allocator>& rhs) noexcept {
-        // Do nothing if both lists are empty
-        if (lhs.empty() && rhs.empty()) {
-            return;
-        }
-
+    template<class T, class Allocator, bool Checked>
+    constexpr void swap(adt::singly_list<T, Allocator, Checked>& lhs,
+                        adt::singly_list<T, Allocator, Checked>& rhs) noexcept {
         return lhs.swap(rhs);
     }
 
-    template<class T, class Allocator, class U = T>
-    constexpr typename adt::singly_list<T, Allocator>::size_type erase(adt::singly_list<T, Allocator>& list, const U& value) noexcept {
+    template<class T, class Allocator, bool Checked, class U = T>
+    constexpr typename adt::singly_list<T, Allocator, Checked>::size_type erase(
+        adt::singly_list<T, Allocator, Checked>& list, const U& value) noexcept {
         return list.remove_if([&](const auto& elem) -> bool { return elem == value; });
     }
 
-    template<class T, class Allocator, class Predicate>
-    constexpr typename adt::singly_list<T, Allocator>::size_type erase_if(adt::singly_list<T, Allocator>& list, Predicate pred) noexcept 
+    template<class T, class Allocator, bool Checked, class Predicate>
+    constexpr typename adt::singly_list<T, Allocator, Checked>::size_type erase_if(
+        adt::singly_list<T, Allocator, Checked>& list, Predicate pred) noexcept 
         requires (std::predicate<Predicate, T>) { return list.remove_if(pred); }
 
 } // std
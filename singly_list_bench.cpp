@@ -0,0 +1,674 @@
+#include <benchmark/benchmark.h>
+
+#include <forward_list> // baseline to compare against
+#include <functional> // std::hash
+#include <string>
+#include <unordered_set>
+#include <random>
+#include <cstdint>
+#include <iterator> // std::next()
+#include <algorithm>
+#include <thread> // std::thread::hardware_concurrency()
+
+#include "node_pool_allocator.hpp"
+#include "singly_list.hpp"
+
+
+/* -------------------------------------------Definitions---------------------------------------------------- */
+using value_type = int;
+
+// A 64-byte element, i.e. one cache line per value (hashable for dedup_all())
+struct payload {
+	std::uint64_t key;
+
+	std::uint64_t padding[7];
+
+	[[nodiscard]] constexpr bool operator<(const payload& rhs) const noexcept { return this->key < rhs.key; }
+
+	[[nodiscard]] constexpr bool operator==(const payload& rhs) const noexcept { return this->key == rhs.key; }
+};
+
+template<>
+struct std::hash<payload> {
+	[[nodiscard]] std::size_t operator()(const payload& value) const noexcept {
+		return std::hash<std::uint64_t>{}(value.key);
+	}
+};
+
+/* ---------------------------------------------Helpers------------------------------------------------------ */
+template<class T>
+T make_value(std::uint64_t key) {
+	if constexpr (std::is_same_v<T, std::string>) {
+		// Long enough to defeat the small string optimization
+		return "singly_list__value__" + std::to_string(key);
+	} else if constexpr (std::is_same_v<T, payload>) {
+		return payload{key, {}};
+	} else {
+		return static_cast<T>(key);
+	}
+}
+
+// Fills `container` with `n` pseudo-random values (the same sequence for every container type)
+template<class Container>
+void fill_random(Container& container, std::size_t n) {
+	std::mt19937_64 engine(n);
+
+	for (std::size_t i = 0; i < n; i++) {
+		container.push_front(make_value<typename Container::value_type>(engine()));
+	}
+}
+
+// Fills `container` with `n` ascending values in which every value appears twice in a row
+template<class Container>
+void fill_pairs(Container& container, std::size_t n) {
+	for (std::size_t i = n; i > 0; i--) {
+		container.push_front(make_value<typename Container::value_type>((i - 1) / 2));
+	}
+}
+
+// Registers `bench` for adt::singly_list and std::forward_list of every element type, for sizes 1e3 to `range_max`
+#define BENCHMARK_CONTAINERS(bench, name, range_max)                                                           \
+	BENCHMARK(bench<adt::singly_list<int>>)->Name("singly_list__" name "<int>")                                \
+		->RangeMultiplier(10)->Range(1'000, range_max);                                                        \
+	BENCHMARK(bench<std::forward_list<int>>)->Name("forward_list__" name "<int>")                              \
+		->RangeMultiplier(10)->Range(1'000, range_max);                                                        \
+	BENCHMARK(bench<adt::singly_list<std::string>>)->Name("singly_list__" name "<std::string>")                \
+		->RangeMultiplier(10)->Range(1'000, range_max);                                                        \
+	BENCHMARK(bench<std::forward_list<std::string>>)->Name("forward_list__" name "<std::string>")              \
+		->RangeMultiplier(10)->Range(1'000, range_max);                                                        \
+	BENCHMARK(bench<adt::singly_list<payload>>)->Name("singly_list__" name "<payload>")                        \
+		->RangeMultiplier(10)->Range(1'000, range_max);                                                        \
+	BENCHMARK(bench<std::forward_list<payload>>)->Name("forward_list__" name "<payload>")                      \
+		->RangeMultiplier(10)->Range(1'000, range_max)
+
+/* ---------------------------------------Construction Benchmarks-------------------------------------------- */
+template<class Container>
+static void bench_construct(benchmark::State& state) {
+	const std::size_t n = static_cast<std::size_t>(state.range(0));
+	const typename Container::value_type value = make_value<typename Container::value_type>(n);
+
+	for (auto _ : state) {
+		Container container(n, value);
+		benchmark::DoNotOptimize(container.front());
+	}
+
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK_CONTAINERS(bench_construct, "construct", 1'000'000);
+
+template<class Container>
+static void bench_copy(benchmark::State& state) {
+	Container source;
+	fill_random(source, static_cast<std::size_t>(state.range(0)));
+
+	for (auto _ : state) {
+		Container copy(source);
+		benchmark::DoNotOptimize(copy.front());
+	}
+
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK_CONTAINERS(bench_copy, "copy", 1'000'000);
+
+// Assigns over a container of the same size, i.e. every element is overwritten and no node is allocated
+template<class Container>
+static void bench_assign(benchmark::State& state) {
+	const std::size_t n = static_cast<std::size_t>(state.range(0));
+	Container source,
+			  container;
+
+	fill_random(source, n);
+	fill_random(container, n);
+
+	for (auto _ : state) {
+		container.assign(source.begin(), source.end());
+		benchmark::DoNotOptimize(container.front());
+	}
+
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK_CONTAINERS(bench_assign, "assign", 1'000'000);
+
+// Copy-assigns a container of the same size, e.g. to refresh a snapshot
+template<class Container>
+static void bench_copy_assign(benchmark::State& state) {
+	const std::size_t n = static_cast<std::size_t>(state.range(0));
+	Container source,
+			  container;
+
+	fill_random(source, n);
+	fill_random(container, n);
+
+	for (auto _ : state) {
+		container = source;
+		benchmark::DoNotOptimize(container.front());
+	}
+
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK_CONTAINERS(bench_copy_assign, "copy_assign", 1'000'000);
+
+/* ------------------------------------------Insertion Benchmarks-------------------------------------------- */
+template<class Container>
+static void bench_push_front(benchmark::State& state) {
+	const std::size_t n = static_cast<std::size_t>(state.range(0));
+	const typename Container::value_type value = make_value<typename Container::value_type>(n);
+
+	for (auto _ : state) {
+		Container container;
+
+		for (std::size_t i = 0; i < n; i++) {
+			container.push_front(value);
+		}
+		benchmark::DoNotOptimize(container.front());
+	}
+
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK_CONTAINERS(bench_push_front, "push_front", 1'000'000);
+
+// Inserts a new element after every element of the list, doubling its size
+template<class Container>
+static void bench_insert_after(benchmark::State& state) {
+	const std::size_t n = static_cast<std::size_t>(state.range(0));
+	const typename Container::value_type value = make_value<typename Container::value_type>(n);
+	Container container;
+
+	for (auto _ : state) {
+		state.PauseTiming();
+		container.clear();
+		fill_random(container, n);
+		state.ResumeTiming();
+
+		for (auto pos = container.cbegin(); pos != container.cend(); ++pos) {
+			pos = container.insert_after(pos, value);
+		}
+		benchmark::DoNotOptimize(container.front());
+	}
+
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK_CONTAINERS(bench_insert_after, "insert_after", 1'000'000);
+
+/* -------------------------------------------Erasure Benchmarks--------------------------------------------- */
+// Erases every other element of the list
+template<class Container>
+static void bench_erase_after(benchmark::State& state) {
+	const std::size_t n = static_cast<std::size_t>(state.range(0));
+	Container container;
+
+	for (auto _ : state) {
+		state.PauseTiming();
+		container.clear();
+		fill_random(container, n);
+		state.ResumeTiming();
+
+		for (auto pos = container.cbegin(); pos != container.cend(); ++pos) {
+			if (std::next(pos) == container.cend()) {
+				break;
+			}
+			container.erase_after(pos);
+		}
+		benchmark::DoNotOptimize(container.front());
+	}
+
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0) / 2);
+}
+BENCHMARK_CONTAINERS(bench_erase_after, "erase_after", 1'000'000);
+
+// Removes every other element of the list
+template<class Container>
+static void bench_remove_if(benchmark::State& state) {
+	const std::size_t n = static_cast<std::size_t>(state.range(0));
+	Container container;
+
+	for (auto _ : state) {
+		state.PauseTiming();
+		container.clear();
+		fill_random(container, n);
+		state.ResumeTiming();
+
+		bool toggle = false;
+		container.remove_if([&toggle](const typename Container::value_type&) { return toggle = !toggle; });
+		benchmark::DoNotOptimize(container.front());
+	}
+
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK_CONTAINERS(bench_remove_if, "remove_if", 1'000'000);
+
+// Removes the duplicate of every element of a sorted list
+template<class Container>
+static void bench_unique(benchmark::State& state) {
+	const std::size_t n = static_cast<std::size_t>(state.range(0));
+	Container container;
+
+	for (auto _ : state) {
+		state.PauseTiming();
+		container.clear();
+		fill_pairs(container, n);
+		state.ResumeTiming();
+
+		container.unique();
+		benchmark::DoNotOptimize(container.front());
+	}
+
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK_CONTAINERS(bench_unique, "unique", 10'000'000);
+
+// Removes every duplicate of a list of random values in which every value appears twice on average
+template<class Container, bool CallerSet>
+static void bench_dedup_all(benchmark::State& state) {
+	using value_type = typename Container::value_type;
+	const std::size_t n = static_cast<std::size_t>(state.range(0));
+	Container container;
+
+	for (auto _ : state) {
+		state.PauseTiming();
+		container.clear();
+		std::mt19937_64 engine(n);
+		for (std::size_t i = 0; i < n; i++) {
+			container.push_front(make_value<value_type>(engine() % (n / 2)));
+		}
+		state.ResumeTiming();
+
+		if constexpr (CallerSet) {
+			std::unordered_set<value_type> seen;
+			seen.reserve(n);
+			benchmark::DoNotOptimize(container.dedup_all(seen));
+		} else {
+			benchmark::DoNotOptimize(container.dedup_all());
+		}
+	}
+
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(bench_dedup_all<adt::singly_list<int>, false>)->Name("singly_list__dedup_all<int>")
+	->RangeMultiplier(10)->Range(1'000, 10'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_dedup_all<adt::singly_list<int>, true>)->Name("singly_list__dedup_all<int, std::unordered_set>")
+	->RangeMultiplier(10)->Range(1'000, 10'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_dedup_all<adt::singly_list<std::string>, false>)->Name("singly_list__dedup_all<std::string>")
+	->RangeMultiplier(10)->Range(1'000, 10'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_dedup_all<adt::singly_list<std::string>, true>)
+	->Name("singly_list__dedup_all<std::string, std::unordered_set>")
+	->RangeMultiplier(10)->Range(1'000, 10'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_dedup_all<adt::singly_list<payload>, false>)->Name("singly_list__dedup_all<payload>")
+	->RangeMultiplier(10)->Range(1'000, 10'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_dedup_all<adt::singly_list<payload>, true>)->Name("singly_list__dedup_all<payload, std::unordered_set>")
+	->RangeMultiplier(10)->Range(1'000, 10'000'000)->Unit(benchmark::kMillisecond);
+
+/* ------------------------------------------Reordering Benchmarks------------------------------------------- */
+template<class Container>
+static void bench_reverse(benchmark::State& state) {
+	Container container;
+	fill_random(container, static_cast<std::size_t>(state.range(0)));
+
+	for (auto _ : state) {
+		container.reverse();
+		benchmark::DoNotOptimize(container.front());
+	}
+
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK_CONTAINERS(bench_reverse, "reverse", 1'000'000);
+
+// Merges two sorted lists of `n` elements each
+template<class Container>
+static void bench_merge(benchmark::State& state) {
+	const std::size_t n = static_cast<std::size_t>(state.range(0));
+	Container container,
+			  other;
+
+	for (auto _ : state) {
+		state.PauseTiming();
+		container.clear();
+		fill_random(container, n);
+		container.sort();
+		fill_random(other, n);
+		other.sort();
+		state.ResumeTiming();
+
+		container.merge(other);
+		benchmark::DoNotOptimize(container.front());
+	}
+
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0) * 2);
+}
+BENCHMARK_CONTAINERS(bench_merge, "merge", 1'000'000);
+
+/* -------------------------------------------Iteration Benchmarks------------------------------------------- */
+template<class Container>
+static void bench_iterate(benchmark::State& state) {
+	Container container;
+	fill_random(container, static_cast<std::size_t>(state.range(0)));
+
+	for (auto _ : state) {
+		for (const typename Container::value_type& value : container) {
+			benchmark::DoNotOptimize(&value);
+		}
+	}
+
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK_CONTAINERS(bench_iterate, "iterate", 10'000'000);
+
+/* ------------------------------------------Push Back Benchmarks-------------------------------------------- */
+static void singly_list__push_back(benchmark::State& state) {
+	const std::size_t n = static_cast<std::size_t>(state.range(0));
+
+	for (auto _ : state) {
+		adt::singly_list<value_type> list;
+
+		for (std::size_t i = 0; i < n; i++) {
+			list.push_back(static_cast<value_type>(i));
+		}
+
+		benchmark::DoNotOptimize(list.back());
+	}
+
+	state.SetComplexityN(state.range(0));
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(singly_list__push_back)->RangeMultiplier(10)->Range(1'000, 100'000'000)
+	->Unit(benchmark::kMillisecond)->Complexity(benchmark::oN);
+
+static void singly_list__emplace_back(benchmark::State& state) {
+	const std::size_t n = static_cast<std::size_t>(state.range(0));
+
+	for (auto _ : state) {
+		adt::singly_list<value_type> list;
+
+		for (std::size_t i = 0; i < n; i++) {
+			list.emplace_back(static_cast<value_type>(i));
+		}
+
+		benchmark::DoNotOptimize(list.back());
+	}
+
+	state.SetComplexityN(state.range(0));
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(singly_list__emplace_back)->RangeMultiplier(10)->Range(1'000, 100'000'000)
+	->Unit(benchmark::kMillisecond)->Complexity(benchmark::oN);
+
+static void singly_list__back(benchmark::State& state) {
+	adt::singly_list<value_type> list(static_cast<std::size_t>(state.range(0)));
+
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(list.back());
+	}
+
+	state.SetComplexityN(state.range(0));
+}
+BENCHMARK(singly_list__back)->RangeMultiplier(10)->Range(1'000, 10'000'000)->Complexity(benchmark::o1);
+
+/* -----------------------------------------Node Cache Benchmarks------------------------------------------- */
+// Clears and refills a list of `n` elements per iteration, as per-request scratch lists are, with a node cache of 0
+// (disabled) or `n` nodes
+static void singly_list__clear_refill(benchmark::State& state) {
+	const std::size_t n = static_cast<std::size_t>(state.range(0));
+	adt::singly_list<value_type> list;
+
+	list.set_node_cache_capacity(static_cast<std::size_t>(state.range(1)) * n);
+
+	for (auto _ : state) {
+		for (std::size_t i = 0; i < n; i++) {
+			list.push_front(static_cast<value_type>(i));
+		}
+		benchmark::DoNotOptimize(list.front());
+
+		list.clear();
+	}
+
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(singly_list__clear_refill)->ArgNames({"n", "cached"})->ArgsProduct({{16, 1'000, 100'000}, {0, 1}});
+
+/* -------------------------------------------Traversal Benchmarks------------------------------------------- */
+// Checked iterators test for nullptr (and may throw) on every dereference and increment; unchecked ones do not
+template<bool Checked>
+static void singly_list__traversal(benchmark::State& state) {
+	adt::singly_list<value_type, std::allocator<value_type>, Checked> list;
+
+	for (std::int64_t i = 0; i < state.range(0); i++) {
+		list.push_front(static_cast<value_type>(i));
+	}
+
+	for (auto _ : state) {
+		std::int64_t sum = 0;
+		for (auto it = list.cbegin(); it != list.cend(); ++it) {
+			sum += *it;
+		}
+		benchmark::DoNotOptimize(sum);
+	}
+
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(singly_list__traversal<true>)->Name("singly_list__traversal<checked>")
+	->RangeMultiplier(10)->Range(1'000, 10'000'000);
+BENCHMARK(singly_list__traversal<false>)->Name("singly_list__traversal<unchecked>")
+	->RangeMultiplier(10)->Range(1'000, 10'000'000);
+
+// Sorting random values scatters the traversal order across memory; compact() restores a sequential layout
+template<class Allocator, bool Compact>
+static void singly_list__traversal__shuffled(benchmark::State& state) {
+	adt::singly_list<value_type, Allocator> list;
+
+	fill_random(list, static_cast<std::size_t>(state.range(0)));
+	list.sort();
+	if constexpr (Compact) {
+		list.compact();
+	}
+
+	for (auto _ : state) {
+		std::int64_t sum = 0;
+		for (const value_type& value : list) {
+			sum += value;
+		}
+		benchmark::DoNotOptimize(sum);
+	}
+
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(singly_list__traversal__shuffled<std::allocator<value_type>, false>)
+	->Name("singly_list__traversal__shuffled<std::allocator>")->RangeMultiplier(10)->Range(1'000, 10'000'000);
+BENCHMARK(singly_list__traversal__shuffled<std::allocator<value_type>, true>)
+	->Name("singly_list__traversal__compacted<std::allocator>")->RangeMultiplier(10)->Range(1'000, 10'000'000);
+BENCHMARK(singly_list__traversal__shuffled<adt::node_pool_allocator<value_type>, false>)
+	->Name("singly_list__traversal__shuffled<adt::node_pool_allocator>")->RangeMultiplier(10)->Range(1'000, 10'000'000);
+BENCHMARK(singly_list__traversal__shuffled<adt::node_pool_allocator<value_type>, true>)
+	->Name("singly_list__traversal__compacted<adt::node_pool_allocator>")->RangeMultiplier(10)->Range(1'000, 10'000'000);
+
+// Visits a list scattered across memory by sort(), prefetching `Distance` nodes ahead. `Work` extra rounds of
+// arithmetic per element stand in for the per-element cost of a real visitor. Use sizes beyond the last level cache
+template<std::size_t Distance, int Work>
+static void singly_list__for_each__prefetch(benchmark::State& state) {
+	adt::singly_list<std::uint64_t> list;
+
+	fill_random(list, static_cast<std::size_t>(state.range(0)));
+	list.sort();
+
+	for (auto _ : state) {
+		std::uint64_t sum = 0;
+		list.for_each<Distance>([&sum](std::uint64_t value) -> void {
+			for (int i = 0; i < Work; i++) {
+				value = value * 6364136223846793005ull + 1442695040888963407ull;
+			}
+			sum += value;
+		});
+		benchmark::DoNotOptimize(sum);
+	}
+
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+#define BENCHMARK_PREFETCH(distance, work)                                                                      \
+	BENCHMARK(singly_list__for_each__prefetch<distance, work>)                                                \
+		->Name("singly_list__for_each__prefetch<" #distance ", work " #work ">")                              \
+		->Arg(1'000'000)->Arg(20'000'000)->Unit(benchmark::kMillisecond)
+BENCHMARK_PREFETCH(0, 0);
+BENCHMARK_PREFETCH(1, 0);
+BENCHMARK_PREFETCH(2, 0);
+BENCHMARK_PREFETCH(4, 0);
+BENCHMARK_PREFETCH(8, 0);
+BENCHMARK_PREFETCH(16, 0);
+BENCHMARK_PREFETCH(0, 32);
+BENCHMARK_PREFETCH(1, 32);
+BENCHMARK_PREFETCH(2, 32);
+BENCHMARK_PREFETCH(4, 32);
+BENCHMARK_PREFETCH(8, 32);
+BENCHMARK_PREFETCH(16, 32);
+
+/* -----------------------------------------Splice After Benchmarks------------------------------------------ */
+static void singly_list__splice_after__list(benchmark::State& state) {
+	adt::singly_list<value_type> list,
+								 other(static_cast<std::size_t>(state.range(0)));
+
+	for (auto _ : state) {
+		// Hand the whole chain back and forth between the two lists
+		list.splice_after(list.cbefore_begin(), other);
+		other.splice_after(other.cbefore_begin(), list);
+	}
+
+	state.SetComplexityN(state.range(0));
+}
+BENCHMARK(singly_list__splice_after__list)->RangeMultiplier(10)->Range(1'000, 1'000'000)->Complexity(benchmark::o1);
+
+static void singly_list__splice_after__range(benchmark::State& state) {
+	adt::singly_list<value_type> list,
+								 other(static_cast<std::size_t>(state.range(0)));
+
+	for (auto _ : state) {
+		list.splice_after(list.cbefore_begin(), other, other.cbefore_begin(), other.cend());
+		other.splice_after(other.cbefore_begin(), list, list.cbefore_begin(), list.cend());
+	}
+
+	state.SetComplexityN(state.range(0));
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0) * 2);
+}
+BENCHMARK(singly_list__splice_after__range)->RangeMultiplier(10)->Range(1'000, 1'000'000)->Complexity(benchmark::oN);
+
+static void forward_list__splice_after__range(benchmark::State& state) {
+	std::forward_list<value_type> list,
+								  other(static_cast<std::size_t>(state.range(0)));
+
+	for (auto _ : state) {
+		list.splice_after(list.cbefore_begin(), other, other.cbefore_begin(), other.cend());
+		other.splice_after(other.cbefore_begin(), list, list.cbefore_begin(), list.cend());
+	}
+
+	state.SetComplexityN(state.range(0));
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0) * 2);
+}
+BENCHMARK(forward_list__splice_after__range)->RangeMultiplier(10)->Range(1'000, 1'000'000)->Complexity(benchmark::oN);
+
+// Moves a single element from the front of one list to the front of the other
+template<class Container>
+static void bench_splice_after__element(benchmark::State& state) {
+	Container list,
+			  other;
+
+	fill_random(list, static_cast<std::size_t>(state.range(0)));
+	fill_random(other, static_cast<std::size_t>(state.range(0)));
+
+	for (auto _ : state) {
+		list.splice_after(list.cbefore_begin(), other, other.cbefore_begin());
+		other.splice_after(other.cbefore_begin(), list, list.cbefore_begin());
+	}
+}
+BENCHMARK_CONTAINERS(bench_splice_after__element, "splice_after__element", 1'000'000);
+
+/* ----------------------------------------------Sort Benchmarks--------------------------------------------- */
+template<class Container>
+static void bench_sort(benchmark::State& state) {
+	const std::size_t n = static_cast<std::size_t>(state.range(0));
+	Container container;
+
+	for (auto _ : state) {
+		state.PauseTiming();
+		container.clear();
+		fill_random(container, n);
+		state.ResumeTiming();
+
+		container.sort();
+		benchmark::DoNotOptimize(container.front());
+	}
+
+	state.SetComplexityN(state.range(0));
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(bench_sort<adt::singly_list<int>>)->Name("singly_list__sort<int>")
+	->RangeMultiplier(10)->Range(1'000, 100'000'000)->Unit(benchmark::kMillisecond)->Complexity(benchmark::oNLogN);
+BENCHMARK(bench_sort<std::forward_list<int>>)->Name("forward_list__sort<int>")
+	->RangeMultiplier(10)->Range(1'000, 100'000'000)->Unit(benchmark::kMillisecond)->Complexity(benchmark::oNLogN);
+BENCHMARK(bench_sort<adt::singly_list<std::string>>)->Name("singly_list__sort<std::string>")
+	->RangeMultiplier(10)->Range(1'000, 100'000'000)->Unit(benchmark::kMillisecond)->Complexity(benchmark::oNLogN);
+BENCHMARK(bench_sort<std::forward_list<std::string>>)->Name("forward_list__sort<std::string>")
+	->RangeMultiplier(10)->Range(1'000, 100'000'000)->Unit(benchmark::kMillisecond)->Complexity(benchmark::oNLogN);
+BENCHMARK(bench_sort<adt::singly_list<payload>>)->Name("singly_list__sort<payload>")
+	->RangeMultiplier(10)->Range(1'000, 100'000'000)->Unit(benchmark::kMillisecond)->Complexity(benchmark::oNLogN);
+BENCHMARK(bench_sort<std::forward_list<payload>>)->Name("forward_list__sort<payload>")
+	->RangeMultiplier(10)->Range(1'000, 100'000'000)->Unit(benchmark::kMillisecond)->Complexity(benchmark::oNLogN);
+
+// Sorts 10^7 random ints with adt::execution::par on 1 up to every hardware thread, to show how the sort scales
+static void bench_sort__parallel(benchmark::State& state) {
+	const std::size_t n = 10'000'000;
+	adt::singly_list<int> list;
+
+	for (auto _ : state) {
+		state.PauseTiming();
+		list.clear();
+		fill_random(list, n);
+		state.ResumeTiming();
+
+		list.sort(adt::execution::par, std::less<int>(), static_cast<std::size_t>(state.range(0)));
+		benchmark::DoNotOptimize(list.front());
+	}
+
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * n);
+}
+BENCHMARK(bench_sort__parallel)->Name("singly_list__sort__parallel<int>")->ArgName("threads")->RangeMultiplier(2)
+	->Range(1, static_cast<int>(std::max(1u, std::thread::hardware_concurrency())))->Unit(benchmark::kMillisecond)
+	->UseRealTime();
+
+/* ----------------------------------------Parallel Algorithm Benchmarks------------------------------------- */
+// adt::execution::par capped at `threads` tasks at once
+struct capped_executor {
+	std::size_t threads;
+
+	std::size_t concurrency() const noexcept { return this->threads; }
+
+	template<class Task>
+	void bulk_execute(std::size_t count, Task task) const noexcept { adt::execution::par.bulk_execute(count, task); }
+};
+
+// Runs a CPU-bound analytic pass over 10^7 ints on 1 up to every hardware thread
+template<class Pass>
+static void bench_parallel_pass(benchmark::State& state, Pass pass) {
+	const std::size_t n = 10'000'000;
+	const capped_executor executor{static_cast<std::size_t>(state.range(0))};
+	adt::singly_list<int> list;
+	fill_random(list, n);
+
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(pass(list, executor));
+	}
+
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * n);
+}
+BENCHMARK_CAPTURE(bench_parallel_pass, count_if, [](const adt::singly_list<int>& list, const capped_executor& executor) {
+	return list.count_if(executor, [](const int& value) -> bool { return value % 3 == 0; });
+})->Name("singly_list__count_if__parallel<int>")->ArgName("threads")->RangeMultiplier(2)
+	->Range(1, static_cast<int>(std::max(1u, std::thread::hardware_concurrency())))->Unit(benchmark::kMillisecond)
+	->UseRealTime();
+BENCHMARK_CAPTURE(bench_parallel_pass, reduce, [](const adt::singly_list<int>& list, const capped_executor& executor) {
+	return list.reduce(executor, std::int64_t(0), std::plus<>());
+})->Name("singly_list__reduce__parallel<int>")->ArgName("threads")->RangeMultiplier(2)
+	->Range(1, static_cast<int>(std::max(1u, std::thread::hardware_concurrency())))->Unit(benchmark::kMillisecond)
+	->UseRealTime();
+BENCHMARK_CAPTURE(bench_parallel_pass, for_each, [](adt::singly_list<int>& list, const capped_executor& executor) {
+	list.for_each(executor, [](int& value) -> void { value = value * 31 + 7; });
+	return list.front();
+})->Name("singly_list__for_each__parallel<int>")->ArgName("threads")->RangeMultiplier(2)
+	->Range(1, static_cast<int>(std::max(1u, std::thread::hardware_concurrency())))->Unit(benchmark::kMillisecond)
+	->UseRealTime();
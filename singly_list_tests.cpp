@@ -2,6 +2,13 @@
 #include <gtest/gtest.h>
 
 #include <vector> // to test std::ranges based members
+#include <memory> // to test move-only elements
+#include <string>
+#include <sstream> // to test input iterators
+#include <iterator>
+#include <unordered_set> // to test dedup_all() with a caller-provided set
+#include <atomic>
+#include <utility> // std::as_const()
 
 #include "singly_list.hpp"
 
@@ -9,6 +16,84 @@
 /* -------------------------------------------Definitions---------------------------------------------------- */
 using value_type = int;
 
+// Counts how many times its instances are copied and moved
+struct counted {
+	static inline int copies = 0;
+
+	static inline int moves = 0;
+
+	std::string value;
+
+	counted() = default;
+
+	counted(std::string value, int repeat) : value() {
+		for (int i = 0; i < repeat; i++) {
+			this->value += value;
+		}
+	}
+
+	counted(const counted& other) : value(other.value) { copies++; }
+
+	counted(counted&& other) noexcept : value(std::move(other.value)) { moves++; }
+
+	counted& operator=(const counted& other) { this->value = other.value; copies++; return *this; }
+
+	counted& operator=(counted&& other) noexcept { this->value = std::move(other.value); moves++; return *this; }
+
+	static void reset() { copies = 0; moves = 0; }
+};
+
+// A stateful allocator that counts its allocations; instances compare equal only when they share the same `id`
+template<class T, bool Propagate>
+struct counting_allocator {
+	using value_type = T;
+
+	using propagate_on_container_move_assignment = std::bool_constant<Propagate>;
+
+	using propagate_on_container_swap = std::bool_constant<Propagate>;
+
+	using is_always_equal = std::false_type;
+
+	template<class U>
+	struct rebind {
+		using other = counting_allocator<U, Propagate>;
+	};
+
+	int id;
+
+	int* allocations;
+
+	counting_allocator(int id, int* allocations) : id(id), allocations(allocations) {}
+
+	template<class U>
+	counting_allocator(const counting_allocator<U, Propagate>& other) : id(other.id), allocations(other.allocations) {}
+
+	T* allocate(std::size_t n) {
+		(*this->allocations)++;
+		return std::allocator<T>().allocate(n);
+	}
+
+	void deallocate(T* ptr, std::size_t n) { std::allocator<T>().deallocate(ptr, n); }
+
+	template<class U>
+	bool operator==(const counting_allocator<U, Propagate>& rhs) const { return this->id == rhs.id; }
+};
+
+// Executor that runs every task on the calling thread, counting them
+struct inline_executor {
+	std::size_t tasks = 0;
+
+	std::size_t concurrency() const noexcept { return 4; }
+
+	template<class Task>
+	void bulk_execute(std::size_t count, Task task) {
+		this->tasks += count;
+		for (std::size_t i = 0; i < count; i++) {
+			task(i);
+		}
+	}
+};
+
 /* --------------------------------Constant Iterator Constructors Tests-------------------------------------- */
 TEST(singly_list__const_iterator__constructors, default_constructor) {
 	adt::singly_list<int>::const_iterator cit;
@@ -250,6 +335,45 @@ TEST(singly_list__iterator__operators, assignment_operator__nullptr) {
 	EXPECT_THROW(it++, std::runtime_error);
 }
 
+TEST(singly_list__iterator__operators, const_iterator_conversion__filled_list) {
+	adt::singly_list<int> list = {1, 3};
+	adt::singly_list<int>::const_iterator pos = list.begin();
+	std::vector<int> matcher = {1, 2, 3, 4};
+
+	// The converted iterator must still belong to `list`
+	EXPECT_NO_THROW(pos = list.insert_after(pos, 2));
+	EXPECT_NO_THROW(list.insert_after(pos + 1, 4));
+
+	EXPECT_TRUE(std::equal(list.begin(), list.end(), matcher.begin(), matcher.end()));
+}
+
+TEST(singly_list__iterator__operators, checked_iterators__throw) {
+	using list_type = adt::singly_list<int, std::allocator<int>, true>;
+	list_type list = {1, 2};
+
+	EXPECT_FALSE(noexcept(*list.cend()));
+	EXPECT_FALSE(noexcept(++list.begin()));
+	EXPECT_THROW(static_cast<void>(list.cbegin() + 3), std::runtime_error);
+	EXPECT_THROW(list.end()++, std::runtime_error);
+}
+
+TEST(singly_list__iterator__operators, unchecked_iterators__noexcept) {
+	using list_type = adt::singly_list<int, std::allocator<int>, false>;
+	list_type list = {1, 2, 3};
+	list_type::const_iterator cit = list.cbegin();
+	list_type::iterator it = list.begin();
+
+	EXPECT_TRUE(noexcept(*cit));
+	EXPECT_TRUE(noexcept(cit.operator->()));
+	EXPECT_TRUE(noexcept(++cit));
+	EXPECT_TRUE(noexcept(cit + 1));
+	EXPECT_TRUE(noexcept(it += 1));
+
+	EXPECT_EQ(*(cit + 2), 3);
+	EXPECT_EQ(*(it += 1), 2);
+	EXPECT_EQ(++it, list.begin() + 2);
+}
+
 /* ------------------------------------Node Type Constructors Tests----------------------------------------- */
 TEST(singly_list__node_type__constructors, default_constructor) {
 	adt::singly_list<int>::node_type node;
@@ -697,6 +821,58 @@ TEST(singly_list__constructors, move_constructor) {
 	EXPECT_THROW(static_cast<void>(*it_src_after), std::runtime_error);
 }
 
+TEST(singly_list__constructors, move_constructor__no_allocations) {
+	int allocations = 0;
+	counting_allocator<int, false> allocator(1, &allocations);
+	adt::singly_list<int, counting_allocator<int, false>> list_src({1, 2, 3}, allocator);
+	std::vector<int> matcher = {1, 2, 3};
+	const int* front = &list_src.front();
+
+	allocations = 0;
+	adt::singly_list<int, counting_allocator<int, false>> list_dst = std::move(list_src);
+
+	EXPECT_EQ(allocations, 0);
+	EXPECT_EQ(&list_dst.front(), front);
+	EXPECT_TRUE(std::equal(list_dst.begin(), list_dst.end(), matcher.begin(), matcher.end()));
+	EXPECT_TRUE(list_src.empty());
+
+	// The moved-from list must still be usable
+	list_src.push_back(4);
+	EXPECT_EQ(list_src.back(), 4);
+}
+
+TEST(singly_list__constructors, move_constructor__equal_allocator__no_allocations) {
+	int allocations = 0;
+	counting_allocator<int, false> allocator(1, &allocations);
+	adt::singly_list<int, counting_allocator<int, false>> list_src({1, 2, 3}, allocator);
+	const int* front = &list_src.front();
+
+	allocations = 0;
+	adt::singly_list<int, counting_allocator<int, false>> list_dst(std::move(list_src), allocator);
+
+	EXPECT_EQ(allocations, 0);
+	EXPECT_EQ(&list_dst.front(), front);
+	EXPECT_EQ(list_dst.size(), 3);
+	EXPECT_TRUE(list_src.empty());
+}
+
+TEST(singly_list__constructors, move_constructor__unequal_allocator__moves_elements) {
+	int src_allocations = 0,
+		dst_allocations = 0;
+	counting_allocator<int, false> src_allocator(1, &src_allocations),
+								   dst_allocator(2, &dst_allocations);
+	adt::singly_list<int, counting_allocator<int, false>> list_src({1, 2, 3}, src_allocator);
+	std::vector<int> matcher = {1, 2, 3};
+
+	adt::singly_list<int, counting_allocator<int, false>> list_dst(std::move(list_src), dst_allocator);
+
+	EXPECT_EQ(dst_allocations, 3);
+	EXPECT_EQ(list_dst.get_allocator().id, 2);
+	EXPECT_TRUE(std::equal(list_dst.begin(), list_dst.end(), matcher.begin(), matcher.end()));
+	EXPECT_EQ(list_dst.back(), 3);
+	EXPECT_TRUE(list_src.empty());
+}
+
 TEST(singly_list__constructors, iterator_constructor) {
 	adt::singly_list<int> init_list = {1, 2, 3},
 						  it_list(init_list.begin(), init_list.end());
@@ -724,6 +900,18 @@ TEST(singly_list__constructors, iterator_constructor) {
 	EXPECT_THROW(it++, std::runtime_error);
 }
 
+TEST(singly_list__constructors, iterator_constructor__input_iterator) {
+	std::istringstream stream("1 2 3 4");
+	adt::singly_list<int> list((std::istream_iterator<int>(stream)), std::istream_iterator<int>());
+	std::initializer_list<int> matcher = {1, 2, 3, 4, 5};
+
+	// The size of an input range is unknown up front, so its nodes are created one at a time
+	list.push_back(5);
+
+	EXPECT_EQ(list, matcher);
+	EXPECT_EQ(list.size(), 5);
+}
+
 TEST(singly_list__constructors, range_constructor) {
 	std::vector<int> vec = {1, 2, 3, 4, 5, 6};
 	adt::singly_list<int> list(std::from_range, vec);
@@ -947,6 +1135,51 @@ TEST(singly_list__operators, assignment_operator__filled_to_filled) {
 	EXPECT_THROW(dst_it++, std::runtime_error);
 }
 
+TEST(singly_list__operators, assignment_operator__equal_size__no_allocations) {
+	int allocations = 0;
+	counting_allocator<int, false> allocator(1, &allocations);
+	adt::singly_list<int, counting_allocator<int, false>> src({1, 2, 3, 4, 5}, allocator),
+														  dst({6, 7, 8, 9, 10}, allocator);
+	const int* front = &dst.front();
+
+	allocations = 0;
+	dst = src;
+
+	// Every node of `dst` is kept and overwritten
+	EXPECT_EQ(allocations, 0);
+	EXPECT_EQ(&dst.front(), front);
+	EXPECT_EQ(dst, src);
+}
+
+TEST(singly_list__operators, assignment_operator__larger_source__allocates_surplus) {
+	int allocations = 0;
+	counting_allocator<int, false> allocator(1, &allocations);
+	adt::singly_list<int, counting_allocator<int, false>> src({1, 2, 3, 4, 5}, allocator),
+														  dst({6, 7}, allocator);
+
+	allocations = 0;
+	dst = src;
+
+	EXPECT_EQ(allocations, 3);
+	EXPECT_EQ(dst, src);
+	EXPECT_EQ(dst.back(), 5);
+}
+
+TEST(singly_list__operators, assignment_operator__smaller_source__frees_deficit) {
+	adt::singly_list<int> src = {1, 2},
+						  dst = {6, 7, 8, 9, 10};
+	std::initializer_list<int> matcher = {1, 2, 3};
+
+	dst = src;
+
+	EXPECT_EQ(dst.size(), 2);
+	EXPECT_EQ(dst.back(), 2);
+
+	// The tail moved back with the list
+	dst.push_back(3);
+	EXPECT_EQ(dst, matcher);
+}
+
 TEST(singly_list__operators, move_operator__empty_to_empty) {
 	adt::singly_list<int> src,
 						  dst;
@@ -1051,6 +1284,70 @@ TEST(singly_list__operators, move_operator__filled_to_filled) {
 	EXPECT_THROW(it_dst++, std::runtime_error);
 }
 
+TEST(singly_list__operators, move_assignment_operator__self_assignment) {
+	adt::singly_list<int> list = {1, 2, 3};
+	adt::singly_list<int>& alias = list;
+
+	list = std::move(alias);
+
+	EXPECT_EQ(list.size(), 3);
+	EXPECT_EQ(list.back(), 3);
+}
+
+TEST(singly_list__operators, move_assignment_operator__propagating_allocator__no_allocations) {
+	int allocations = 0;
+	counting_allocator<int, true> src_allocator(1, &allocations),
+								  dst_allocator(2, &allocations);
+	adt::singly_list<int, counting_allocator<int, true>> src({1, 2, 3}, src_allocator),
+														 dst({4, 5}, dst_allocator);
+	const int* front = &src.front();
+
+	allocations = 0;
+	dst = std::move(src);
+
+	EXPECT_EQ(allocations, 0);
+	EXPECT_EQ(dst.get_allocator().id, 1);
+	EXPECT_EQ(&dst.front(), front);
+	EXPECT_EQ(dst.size(), 3);
+	EXPECT_EQ(dst.back(), 3);
+	EXPECT_TRUE(src.empty());
+}
+
+TEST(singly_list__operators, move_assignment_operator__equal_allocator__no_allocations) {
+	int allocations = 0;
+	counting_allocator<int, false> allocator(1, &allocations);
+	adt::singly_list<int, counting_allocator<int, false>> src({1, 2, 3}, allocator),
+														  dst({4, 5}, allocator);
+	const int* front = &src.front();
+
+	allocations = 0;
+	dst = std::move(src);
+
+	EXPECT_EQ(allocations, 0);
+	EXPECT_EQ(&dst.front(), front);
+	EXPECT_EQ(dst.size(), 3);
+	EXPECT_TRUE(src.empty());
+}
+
+TEST(singly_list__operators, move_assignment_operator__unequal_allocator__moves_elements) {
+	int src_allocations = 0,
+		dst_allocations = 0;
+	counting_allocator<int, false> src_allocator(1, &src_allocations),
+								   dst_allocator(2, &dst_allocations);
+	adt::singly_list<int, counting_allocator<int, false>> src({1, 2, 3}, src_allocator),
+														  dst({4, 5}, dst_allocator);
+	std::vector<int> matcher = {1, 2, 3};
+
+	dst_allocations = 0;
+	dst = std::move(src);
+
+	// The allocator does not propagate, so every element needs a node from `dst`'s allocator
+	EXPECT_EQ(dst_allocations, 3);
+	EXPECT_EQ(dst.get_allocator().id, 2);
+	EXPECT_TRUE(std::equal(dst.begin(), dst.end(), matcher.begin(), matcher.end()));
+	EXPECT_TRUE(src.empty());
+}
+
 TEST(singly_list__operators, equals_operator__singly_list__both_empty) {
 	adt::singly_list<int> lhs, rhs;
 	
@@ -1166,7 +1463,7 @@ TEST(singly_list__methods, assign__value__count_greater_than_list_size) {
 TEST(singly_list__methods, assign__value__count_less_than_list_size) {
 	adt::singly_list<int> list(10, 101);
 	adt::singly_list<int>::size_type sz;
-	std::initializer_list<int> matcher = {69, 69, 69, 69, 69, 101, 101, 101, 101, 101};
+	std::initializer_list<int> matcher = {69, 69, 69, 69, 69};
 
 	// Check size before calling assign()
 	EXPECT_NO_THROW(sz = list.size());
@@ -1176,7 +1473,7 @@ TEST(singly_list__methods, assign__value__count_less_than_list_size) {
 
 	// Check size after calling assign()
 	EXPECT_NO_THROW(sz = list.size());
-	EXPECT_EQ(sz, 10);
+	EXPECT_EQ(sz, 5);
 
 	EXPECT_EQ(list, matcher);
 }
@@ -1205,7 +1502,7 @@ TEST(singly_list__methods, assign__iterators__filled_list_empty_container) {
 	adt::singly_list<int>::const_iterator cit;
 	adt::singly_list<int>::size_type sz;
 	std::vector<int> vec;
-	std::initializer_list<int> matcher = {1, 2, 3, 4, 5};
+	std::initializer_list<int> matcher;
 
 	// Check size before calling assign()
 	EXPECT_NO_THROW(sz = list.size());
@@ -1216,7 +1513,8 @@ TEST(singly_list__methods, assign__iterators__filled_list_empty_container) {
 
 	// Check size after calling assign()
 	EXPECT_NO_THROW(sz = list.size());
-	EXPECT_EQ(sz, 5);
+	EXPECT_EQ(sz, 0);
+	EXPECT_EQ(cit, nullptr);
 
 	EXPECT_EQ(list, matcher);
 }
@@ -1244,7 +1542,7 @@ TEST(singly_list__methods, assign__iterators__list_size_greater_than_container_s
 	adt::singly_list<int> list = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
 	adt::singly_list<int>::size_type size;
 	std::vector<int> vec = {5, 4, 3, 2, 1};
-	std::initializer_list<int> matcher = {5, 4, 3, 2, 1, 6, 7, 8, 9, 10};
+	std::initializer_list<int> matcher = {5, 4, 3, 2, 1};
 
 	// Check size before calling assign()
 	EXPECT_NO_THROW(size = list.size());
@@ -1254,7 +1552,7 @@ TEST(singly_list__methods, assign__iterators__list_size_greater_than_container_s
 
 	// Check size after calling assign()
 	EXPECT_NO_THROW(size = list.size());
-	EXPECT_EQ(size, 10);
+	EXPECT_EQ(size, 5);
 
 	EXPECT_EQ(list, matcher);
 }
@@ -1333,7 +1631,7 @@ TEST(singly_list__methods, assign__initializer_list__list_size_greater_than_init
 	adt::singly_list<int> list = {15, 16, 14, 13, 12, 11, 10, 9, 8, 7, 6};
 	adt::singly_list<int>::size_type sz;
 	std::initializer_list<int> values = {1, 2, 3, 4, 5},
-							   matcher = {1, 2, 3, 4, 5, 11, 10, 9, 8, 7, 6};
+							   matcher = {1, 2, 3, 4, 5};
 
 	// Check size before call to assign()
 	EXPECT_NO_THROW(sz = list.size());
@@ -1343,7 +1641,7 @@ TEST(singly_list__methods, assign__initializer_list__list_size_greater_than_init
 
 	// Check size after call to assign()
 	EXPECT_NO_THROW(sz = list.size());
-	EXPECT_EQ(sz, 11);
+	EXPECT_EQ(sz, 5);
 
 	EXPECT_EQ(list, matcher);
 }
@@ -1423,7 +1721,7 @@ TEST(singly_list__methods, assign_range__list_size_greater_than_container_size)
 	adt::singly_list<int> list = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
 	adt::singly_list<int>::size_type sz;
 	std::vector<int> vec = {5, 4, 3, 2, 1};
-	std::initializer_list<int> matcher = {5, 4, 3, 2, 1, 6, 7, 8, 9, 10};
+	std::initializer_list<int> matcher = {5, 4, 3, 2, 1};
 
 	// Check size before calling assign()
 	EXPECT_NO_THROW(sz = list.size());
@@ -1433,7 +1731,7 @@ TEST(singly_list__methods, assign_range__list_size_greater_than_container_size)
 
 	// Check size after calling assign()
 	EXPECT_NO_THROW(sz = list.size());
-	EXPECT_EQ(sz, 10);
+	EXPECT_EQ(sz, 5);
 
 	EXPECT_EQ(list, matcher);
 }
@@ -1457,6 +1755,36 @@ TEST(singly_list__methods, assign_range__list_size_less_than_container_size) {
 	EXPECT_EQ(list, matcher);
 }
 
+TEST(singly_list__methods, assign__equal_size__no_allocations) {
+	int allocations = 0;
+	counting_allocator<int, false> allocator(1, &allocations);
+	adt::singly_list<int, counting_allocator<int, false>> list({1, 2, 3, 4, 5}, allocator);
+	std::vector<int> vec = {5, 4, 3, 2, 1};
+	std::initializer_list<int> matcher = {1, 2, 3, 4, 5};
+
+	allocations = 0;
+	list.assign(5, 0);
+	list.assign(vec.begin(), vec.end());
+	list.assign({1, 2, 3, 4, 5});
+	list.assign_range(vec);
+	list.assign_range(std::vector<int>(matcher));
+
+	EXPECT_EQ(allocations, 0);
+	EXPECT_EQ(list, matcher);
+}
+
+TEST(singly_list__methods, assign__input_iterators__frees_deficit) {
+	adt::singly_list<int> list = {9, 9, 9, 9, 9};
+	std::istringstream stream("1 2 3");
+	std::initializer_list<int> matcher = {1, 2, 3, 4};
+
+	list.assign(std::istream_iterator<int>(stream), std::istream_iterator<int>());
+
+	EXPECT_EQ(list.size(), 3);
+	list.push_back(4);
+	EXPECT_EQ(list, matcher);
+}
+
 TEST(singly_list__methods, front__empty) {
 	adt::singly_list<int> list;
 
@@ -2822,6 +3150,68 @@ TEST(singly_list__methods, splice_after__rref_and_iterator_range__every_other) {
 
 }
 
+TEST(singly_list__methods, splice_after__lref__relinks_nodes) {
+	adt::singly_list<int> list = {1, 2, 3},
+						  other = {4, 5, 6};
+	const int* front = &other.front(),
+			 * back = &other.back();
+	std::initializer_list<int> matcher = {1, 4, 5, 6, 2, 3};
+
+	EXPECT_NO_THROW(list.splice_after(list.cbegin(), other));
+
+	EXPECT_EQ(list, matcher);
+	EXPECT_EQ(&*(list.cbegin() + 1), front);
+	EXPECT_EQ(&*(list.cbegin() + 3), back);
+	EXPECT_TRUE(other.empty());
+}
+
+TEST(singly_list__methods, splice_after__lref_and_iterator__relinks_node) {
+	adt::singly_list<int> list = {1, 2, 3},
+						  other = {4, 5, 6};
+	const int* spliced = &*(other.cbegin() + 1);
+	std::initializer_list<int> matcher = {1, 2, 3, 5},
+							   other_matcher = {4, 6};
+
+	EXPECT_NO_THROW(list.splice_after(list.cbegin() + 2, other, other.cbegin()));
+
+	EXPECT_EQ(list, matcher);
+	EXPECT_EQ(other, other_matcher);
+	EXPECT_EQ(&list.back(), spliced);
+	EXPECT_EQ(list.size(), 4);
+	EXPECT_EQ(other.size(), 2);
+}
+
+TEST(singly_list__methods, splice_after__lref_and_iterator__same_position) {
+	adt::singly_list<int> list = {1, 2, 3};
+	std::initializer_list<int> matcher = {1, 2, 3};
+
+	EXPECT_NO_THROW(list.splice_after(list.cbegin(), list, list.cbegin()));
+	EXPECT_NO_THROW(list.splice_after(list.cbegin() + 1, list, list.cbegin()));
+
+	EXPECT_EQ(list, matcher);
+	EXPECT_EQ(list.size(), 3);
+}
+
+TEST(singly_list__methods, splice_after__lref_and_iterator_range__relinks_nodes) {
+	adt::singly_list<int> list = {1, 2},
+						  other = {3, 4, 5, 6};
+	const int* first = &*(other.cbegin() + 1),
+			 * last = &other.back();
+	std::initializer_list<int> matcher = {1, 2, 4, 5, 6},
+							   other_matcher = {3, 7};
+
+	EXPECT_NO_THROW(list.splice_after(list.cbegin() + 1, other, other.cbegin(), other.cend()));
+
+	EXPECT_EQ(list, matcher);
+	EXPECT_EQ(&*(list.cbegin() + 2), first);
+	EXPECT_EQ(&list.back(), last);
+	EXPECT_EQ(list.size(), 5);
+	EXPECT_EQ(other.size(), 1);
+
+	other.push_back(7);
+	EXPECT_EQ(other, other_matcher);
+}
+
 TEST(singly_list__methods, push_back__empty) {
 	adt::singly_list<int> list;
 	adt::singly_list<int>::value_type value;
@@ -2844,6 +3234,99 @@ TEST(singly_list__methods, push_back__filled) {
 	EXPECT_EQ(value, 4);
 }
 
+TEST(singly_list__methods, push_back__after_pop_back) {
+	adt::singly_list<int> list = {1, 2, 3};
+	std::initializer_list<int> matcher = {1, 2, 4};
+
+	EXPECT_NO_THROW(list.pop_back());
+	list.push_back(4);
+
+	EXPECT_EQ(list.size(), 3);
+	EXPECT_EQ(list.back(), 4);
+	EXPECT_EQ(list, matcher);
+}
+
+TEST(singly_list__methods, push_back__after_clear) {
+	adt::singly_list<int> list = {1, 2, 3};
+
+	list.clear();
+	list.push_back(4);
+
+	EXPECT_EQ(list.size(), 1);
+	EXPECT_EQ(list.front(), 4);
+	EXPECT_EQ(list.back(), 4);
+}
+
+TEST(singly_list__methods, push_back__after_erase_after_tail) {
+	adt::singly_list<int> list = {1, 2, 3};
+	std::initializer_list<int> matcher = {1, 2, 4};
+
+	EXPECT_NO_THROW(list.erase_after(list.cbegin() + 1));
+	EXPECT_EQ(list.back(), 2);
+
+	list.push_back(4);
+
+	EXPECT_EQ(list.back(), 4);
+	EXPECT_EQ(list, matcher);
+}
+
+TEST(singly_list__methods, push_back__after_splice_after) {
+	adt::singly_list<int> list = {1, 2},
+						  other = {3, 4};
+	std::initializer_list<int> matcher = {1, 2, 3, 4, 5},
+							   other_matcher = {6};
+
+	EXPECT_NO_THROW(list.splice_after(list.cbegin() + 1, other));
+	EXPECT_EQ(list.back(), 4);
+
+	list.push_back(5);
+	other.push_back(6);
+
+	EXPECT_EQ(list, matcher);
+	EXPECT_EQ(other, other_matcher);
+	EXPECT_EQ(other.back(), 6);
+}
+
+TEST(singly_list__methods, push_back__after_remove_if) {
+	adt::singly_list<int> list = {1, 2, 3, 4};
+	std::initializer_list<int> matcher = {1, 3, 5};
+
+	list.remove_if([](int value) -> bool { return value % 2 == 0; });
+	EXPECT_EQ(list.back(), 3);
+
+	list.push_back(5);
+
+	EXPECT_EQ(list, matcher);
+}
+
+TEST(singly_list__methods, push_back__after_reverse_and_sort) {
+	adt::singly_list<int> list = {3, 1, 2};
+
+	list.reverse();
+	EXPECT_EQ(list.back(), 3);
+
+	list.sort();
+	EXPECT_EQ(list.back(), 3);
+
+	list.push_back(4);
+	EXPECT_EQ(list.back(), 4);
+	EXPECT_EQ(list.size(), 4);
+}
+
+TEST(singly_list__methods, emplace_back__after_move) {
+	adt::singly_list<int> src = {1, 2, 3},
+						  dst = {7, 8};
+
+	dst = std::move(src);
+	dst.emplace_back(4);
+	src.emplace_back(5);
+
+	EXPECT_EQ(dst.back(), 4);
+	EXPECT_EQ(dst.size(), 4);
+	EXPECT_EQ(src.front(), 5);
+	EXPECT_EQ(src.back(), 5);
+}
+
 TEST(singly_list__methods, push_front__empty) {
 	adt::singly_list<int> list;
 	adt::singly_list<int>::value_type value;
@@ -2994,6 +3477,97 @@ TEST(singly_list__methods, emplace_front__filled) {
 	EXPECT_EQ(value, -1);
 }
 
+TEST(singly_list__methods, emplace__in_place) {
+	adt::singly_list<counted> list;
+	counted::reset();
+
+	list.emplace_back("ab", 2);
+	list.emplace_front("c", 3);
+	list.emplace_after(list.cbegin(), "d", 1);
+
+	EXPECT_EQ(counted::copies, 0);
+	EXPECT_EQ(counted::moves, 0);
+	EXPECT_EQ(list.front().value, "ccc");
+	EXPECT_EQ((list.begin() + 1)->value, "d");
+	EXPECT_EQ(list.back().value, "abab");
+}
+
+TEST(singly_list__methods, push__rvalue_moves) {
+	adt::singly_list<counted> list;
+	counted value("x", 4);
+	counted::reset();
+
+	list.push_back(std::move(value));
+	list.push_front(counted("y", 1));
+	list.insert_after(list.cbegin(), counted("z", 1));
+
+	EXPECT_EQ(counted::copies, 0);
+	EXPECT_EQ(counted::moves, 3);
+	EXPECT_EQ(list.back().value, "xxxx");
+}
+
+TEST(singly_list__methods, push__lvalue_copies) {
+	adt::singly_list<counted> list;
+	counted value("x", 4);
+	counted::reset();
+
+	list.push_back(value);
+	list.push_front(value);
+	list.insert_after(list.cbegin(), value);
+
+	// The source must be left untouched
+	EXPECT_EQ(counted::copies, 3);
+	EXPECT_EQ(counted::moves, 0);
+	EXPECT_EQ(value.value, "xxxx");
+	EXPECT_EQ(list.front().value, "xxxx");
+}
+
+TEST(singly_list__methods, move_only_elements) {
+	adt::singly_list<std::unique_ptr<int>> list,
+										   other;
+	std::unique_ptr<int> value = std::make_unique<int>(2);
+
+	list.push_back(std::move(value));
+	list.push_front(std::make_unique<int>(1));
+	list.emplace_back(std::make_unique<int>(5));
+	list.emplace_after(list.cbegin() + 1, new int(3));
+	list.insert_after(list.cbegin() + 2, std::make_unique<int>(4));
+
+	ASSERT_EQ(list.size(), 5);
+	for (int i = 1; const std::unique_ptr<int>& element : list) {
+		EXPECT_EQ(*element, i++);
+	}
+
+	other.splice_after(other.cbefore_begin(), list, list.cbegin(), list.cend());
+	list.reverse();
+	list.sort([](const std::unique_ptr<int>& lhs, const std::unique_ptr<int>& rhs) { return *lhs < *rhs; });
+	list.pop_front();
+	list.swap(other);
+
+	adt::singly_list<std::unique_ptr<int>> moved = std::move(list);
+
+	EXPECT_EQ(moved.size(), 4);
+	EXPECT_EQ(*moved.front(), 2);
+	EXPECT_EQ(*moved.back(), 5);
+	EXPECT_TRUE(other.empty());
+}
+
+TEST(singly_list__methods, insert_range_after__middle) {
+	adt::singly_list<int> list = {1, 5};
+	std::vector<int> values = {2, 3, 4};
+	std::initializer_list<int> matcher = {1, 2, 3, 4, 5, 6, 7};
+	adt::singly_list<int>::iterator it;
+
+	EXPECT_NO_THROW(it = list.insert_range_after(list.cbegin(), values));
+	EXPECT_EQ(*it, 4);
+
+	list.append_range(std::vector<int>{6});
+	list.push_back(7);
+
+	EXPECT_EQ(list, matcher);
+	EXPECT_EQ(list.size(), 7);
+}
+
 TEST(singly_list__methods, prepend_range__empty) {
 	adt::singly_list<int> list;
 	adt::singly_list<int>::size_type sz;
@@ -3076,6 +3650,84 @@ TEST(singly_list__methods, swap) {
 	EXPECT_EQ(value, 1);
 }
 
+TEST(singly_list__methods, swap__tail_and_size) {
+	adt::singly_list<int> list1 = {1, 2, 3},
+						  list2;
+
+	list1.swap(list2);
+
+	EXPECT_TRUE(list1.empty());
+	EXPECT_EQ(list2.size(), 3);
+	EXPECT_EQ(list2.back(), 3);
+
+	list1.push_back(4);
+	list2.push_back(5);
+
+	EXPECT_EQ(list1.front(), 4);
+	EXPECT_EQ(list1.back(), 4);
+	EXPECT_EQ(list2.back(), 5);
+	EXPECT_EQ(list2.size(), 4);
+}
+
+TEST(singly_list__methods, swap__propagating_allocator) {
+	int allocations1 = 0,
+		allocations2 = 0;
+	counting_allocator<int, true> allocator1(1, &allocations1),
+								  allocator2(2, &allocations2);
+	adt::singly_list<int, counting_allocator<int, true>> list1({1, 2, 3}, allocator1),
+														 list2({4}, allocator2);
+
+	// Leave a cached node from `allocator1`, which must follow it to `list2`
+	list1.set_node_cache_capacity(4);
+	list2.set_node_cache_capacity(4);
+	list1.pop_front();
+	const int* front = &list1.front();
+
+	list1.swap(list2);
+
+	EXPECT_EQ(list1.size(), 1);
+	EXPECT_EQ(list1.front(), 4);
+	EXPECT_EQ(list2.size(), 2);
+	EXPECT_EQ(&list2.front(), front);
+	EXPECT_EQ(list1.get_allocator().id, 2);
+	EXPECT_EQ(list2.get_allocator().id, 1);
+
+	// Each list now allocates from the allocator it received, `list2` first reusing the cached node
+	allocations1 = 0;
+	allocations2 = 0;
+	list1.push_back(5);
+	list2.push_back(6);
+	list2.push_back(7);
+
+	EXPECT_EQ(allocations2, 1);
+	EXPECT_EQ(allocations1, 1);
+	EXPECT_EQ(list2.back(), 7);
+}
+
+TEST(singly_list__methods, swap__unequal_allocator) {
+	int allocations1 = 0,
+		allocations2 = 0;
+	counting_allocator<int, false> allocator1(1, &allocations1),
+								   allocator2(2, &allocations2);
+	adt::singly_list<int, counting_allocator<int, false>> list1({1, 2, 3}, allocator1),
+														  list2({4, 5}, allocator2);
+
+	allocations1 = 0;
+	allocations2 = 0;
+	list1.swap(list2);
+
+	// The elements moved across, each list keeping its allocator
+	EXPECT_EQ(allocations1, 2);
+	EXPECT_EQ(allocations2, 3);
+	EXPECT_EQ(list1.get_allocator().id, 1);
+	EXPECT_EQ(list2.get_allocator().id, 2);
+	EXPECT_EQ(list1.size(), 2);
+	EXPECT_EQ(list1.back(), 5);
+	EXPECT_EQ(list2.size(), 3);
+	EXPECT_EQ(list2.back(), 3);
+	EXPECT_EQ(list2.front(), 1);
+}
+
 TEST(singly_list__methods, reverse__empty) {
 	adt::singly_list<int> list;
 	list.reverse();
@@ -3194,6 +3846,93 @@ TEST(singly_list__methods, unique__filled__mixed) {
 	EXPECT_EQ(list.size(), 6);
 }
 
+TEST(singly_list__methods, unique__non_adjacent_duplicates) {
+	adt::singly_list<int> list = {1, 1, 2, 1, 2, 2, 3, 1};
+	std::initializer_list<int> matcher = {1, 2, 1, 2, 3, 1};
+
+	// Only consecutive duplicates are removed
+	EXPECT_EQ(list.unique(), 2);
+
+	EXPECT_EQ(list, matcher);
+	EXPECT_EQ(list.size(), 6);
+	EXPECT_EQ(list.back(), 1);
+}
+
+TEST(singly_list__methods, unique__binary_predicate) {
+	adt::singly_list<int> list = {1, 3, 5, 2, 4, 7, 8, 10};
+	std::initializer_list<int> matcher = {1, 2, 7, 8};
+
+	// Remove every element with the same parity as the element kept before it
+	EXPECT_EQ(list.unique([](int lhs, int rhs) -> bool { return lhs % 2 == rhs % 2; }), 4);
+
+	EXPECT_EQ(list, matcher);
+	list.push_back(11);
+	EXPECT_EQ(list.back(), 11);
+	EXPECT_EQ(list.size(), 5);
+}
+
+TEST(singly_list__methods, dedup_all__filled) {
+	adt::singly_list<int> list = {3, 1, 3, 2, 1, 4, 2, 3, 5, 5};
+	std::initializer_list<int> matcher = {3, 1, 2, 4, 5};
+
+	EXPECT_EQ(list.dedup_all(), 5);
+
+	EXPECT_EQ(list, matcher);
+	EXPECT_EQ(list.size(), 5);
+	EXPECT_EQ(list.back(), 5);
+}
+
+TEST(singly_list__methods, dedup_all__empty_and_single) {
+	adt::singly_list<int> list;
+
+	EXPECT_EQ(list.dedup_all(), 0);
+
+	list.push_back(1);
+	EXPECT_EQ(list.dedup_all(), 0);
+	EXPECT_EQ(list.size(), 1);
+}
+
+TEST(singly_list__methods, dedup_all__large_list) {
+	adt::singly_list<int> list;
+	const int n = 100'000;
+
+	for (int i = 0; i < n; i++) {
+		list.push_back(i % 1'000);
+	}
+
+	EXPECT_EQ(list.dedup_all(), n - 1'000);
+	EXPECT_EQ(list.size(), 1'000);
+	EXPECT_EQ(list.front(), 0);
+	EXPECT_EQ(list.back(), 999);
+}
+
+TEST(singly_list__methods, dedup_all__custom_hash_and_equal) {
+	adt::singly_list<std::string> list = {"a", "B", "A", "b", "c"};
+	std::initializer_list<std::string> matcher = {"a", "B", "c"};
+	auto lower = [](char c) -> char { return static_cast<char>(std::tolower(static_cast<unsigned char>(c))); };
+
+	EXPECT_EQ(list.dedup_all(
+		[&](const std::string& value) -> std::size_t { return std::hash<char>{}(lower(value[0])); },
+		[&](const std::string& lhs, const std::string& rhs) -> bool { return lower(lhs[0]) == lower(rhs[0]); }
+	), 2);
+
+	EXPECT_EQ(list, matcher);
+}
+
+TEST(singly_list__methods, dedup_all__caller_set) {
+	adt::singly_list<int> list = {4, 4, 1, 2, 1, 4};
+	std::initializer_list<int> matcher = {4, 1, 2};
+	std::unordered_set<int> seen;
+
+	seen.reserve(list.size());
+
+	EXPECT_EQ(list.dedup_all(seen), 3);
+
+	EXPECT_EQ(list, matcher);
+	EXPECT_EQ(list.back(), 2);
+	EXPECT_EQ(seen.size(), 3);
+}
+
 TEST(singly_list__methods, sort__accending_order) {
 	adt::singly_list<int> list = {1, 3, 6, 2, 5, 4};
 	adt::singly_list<int>::const_iterator cit;
@@ -3261,6 +4000,463 @@ TEST(singly_list__methods, sort__decending_order) {
 	EXPECT_EQ(value, 1);
 }
 
+TEST(singly_list__methods, sort__stable) {
+	adt::singly_list<std::pair<int, char>> list = {{2, 'a'}, {1, 'b'}, {2, 'c'}, {1, 'd'}, {0, 'e'}, {2, 'f'}};
+	std::initializer_list<std::pair<int, char>> matcher = {{0, 'e'}, {1, 'b'}, {1, 'd'}, {2, 'a'}, {2, 'c'}, {2, 'f'}};
+
+	list.sort([](const auto& lhs, const auto& rhs) -> bool { return lhs.first < rhs.first; });
+
+	EXPECT_EQ(list, matcher);
+	EXPECT_EQ(list.size(), 6);
+	EXPECT_EQ(list.back(), std::make_pair(2, 'f'));
+}
+
+TEST(singly_list__methods, sort__large_list) {
+	adt::singly_list<int> list;
+	const int n = 1'000'000;
+
+	// Too many nodes for a sort that recurses once per element
+	for (int i = 0; i < n; i++) {
+		list.push_front(i);
+	}
+
+	EXPECT_NO_THROW(list.sort());
+
+	EXPECT_TRUE(list.is_sorted());
+	EXPECT_EQ(list.size(), n);
+	EXPECT_EQ(list.front(), 0);
+	EXPECT_EQ(list.back(), n - 1);
+}
+
+TEST(singly_list__methods, sort__parallel__stable) {
+	adt::singly_list<std::pair<int, int>> list;
+	std::vector<std::pair<int, int>> matcher;
+	const auto by_key = [](const auto& lhs, const auto& rhs) -> bool { return lhs.first < rhs.first; };
+
+	// Many equal keys spread across every run, tagged with their original position
+	for (int i = 0; i < 200'000; i++) {
+		list.push_back({(i * 7'919) % 1'000, i});
+		matcher.push_back({(i * 7'919) % 1'000, i});
+	}
+	std::stable_sort(matcher.begin(), matcher.end(), by_key);
+
+	list.sort(adt::execution::par, by_key, 4);
+
+	EXPECT_EQ(list.size(), 200'000);
+	EXPECT_TRUE(std::equal(list.begin(), list.end(), matcher.begin(), matcher.end()));
+
+	// The tail must follow the last node of the sorted list
+	EXPECT_EQ(list.back(), matcher.back());
+	list.push_back({-1, -1});
+	EXPECT_EQ(list.back(), std::make_pair(-1, -1));
+}
+
+TEST(singly_list__methods, sort__parallel__odd_thread_count) {
+	adt::singly_list<int> list;
+	const int n = 300'000;
+
+	for (int i = 0; i < n; i++) {
+		list.push_front(i);
+	}
+
+	list.sort(adt::execution::par, std::less<int>(), 3);
+
+	EXPECT_TRUE(list.is_sorted());
+	EXPECT_EQ(list.size(), n);
+	EXPECT_EQ(list.front(), 0);
+	EXPECT_EQ(list.back(), n - 1);
+}
+
+TEST(singly_list__methods, sort__parallel__small_list) {
+	adt::singly_list<int> list = {3, 1, 2},
+						  empty;
+	std::initializer_list<int> matcher = {1, 2, 3};
+
+	list.sort(adt::execution::par);
+	empty.sort(adt::execution::par);
+
+	EXPECT_EQ(list, matcher);
+	EXPECT_EQ(list.back(), 3);
+	EXPECT_TRUE(empty.empty());
+}
+
+TEST(singly_list__methods, sort__executor) {
+	adt::singly_list<int> list;
+	inline_executor executor;
+	const int n = 100'000;
+
+	for (int i = 0; i < n; i++) {
+		list.push_front(i);
+	}
+
+	list.sort(executor);
+
+	EXPECT_TRUE(list.is_sorted());
+	EXPECT_EQ(list.back(), n - 1);
+	EXPECT_GT(executor.tasks, 0);
+}
+
+TEST(singly_list__methods, segments__balanced) {
+	adt::singly_list<int> list = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+	std::vector<std::size_t> lengths;
+	int value = 0;
+
+	for (const auto& segment : list.segments(3)) {
+		lengths.push_back(static_cast<std::size_t>(std::ranges::distance(segment)));
+
+		// Segments are consecutive and cover the whole list
+		for (int element : segment) {
+			EXPECT_EQ(element, value++);
+		}
+	}
+
+	EXPECT_EQ(lengths, std::vector<std::size_t>({4, 3, 3}));
+	EXPECT_EQ(value, 10);
+}
+
+TEST(singly_list__methods, segments__more_than_size) {
+	const adt::singly_list<int> list = {1, 2, 3},
+								empty;
+
+	EXPECT_EQ(list.segments(5).size(), 3);
+	EXPECT_TRUE(empty.segments(2).empty());
+	EXPECT_THROW(static_cast<void>(list.segments(0)), std::invalid_argument);
+}
+
+TEST(singly_list__methods, for_each__parallel) {
+	adt::singly_list<int> list;
+	inline_executor executor;
+	std::atomic<long long> sum = 0;
+	const int n = 100'000;
+
+	for (int i = 0; i < n; i++) {
+		list.push_back(i);
+	}
+
+	list.for_each(adt::execution::par, [](int& value) -> void { value *= 2; });
+	std::as_const(list).for_each(executor, [&](const int& value) -> void { sum += value; });
+
+	EXPECT_EQ(sum, static_cast<long long>(n) * (n - 1));
+	EXPECT_EQ(executor.tasks, 4);
+}
+
+TEST(singly_list__methods, transform_inplace__parallel) {
+	adt::singly_list<int> list;
+	const int n = 100'000;
+
+	for (int i = 0; i < n; i++) {
+		list.push_back(i);
+	}
+
+	list.transform_inplace(adt::execution::par, [](const int& value) -> int { return value + 1; });
+
+	EXPECT_EQ(list.front(), 1);
+	EXPECT_EQ(list.back(), n);
+	EXPECT_EQ(list.size(), n);
+}
+
+TEST(singly_list__methods, count_if__parallel) {
+	adt::singly_list<int> list;
+	inline_executor executor;
+	const int n = 100'001;
+
+	for (int i = 0; i < n; i++) {
+		list.push_back(i);
+	}
+
+	EXPECT_EQ(list.count_if(executor, [](const int& value) -> bool { return value % 2 == 0; }), 50'001);
+	EXPECT_EQ(list.count_if(adt::execution::par, [](const int& value) -> bool { return value < 0; }), 0);
+}
+
+TEST(singly_list__methods, reduce__parallel) {
+	adt::singly_list<int> list,
+						  empty;
+	inline_executor executor;
+	const int n = 100'000;
+
+	for (int i = 0; i < n; i++) {
+		list.push_back(i);
+	}
+
+	EXPECT_EQ(list.reduce(executor, 10LL, std::plus<>()), static_cast<long long>(n) * (n - 1) / 2 + 10);
+	EXPECT_EQ(list.reduce(adt::execution::par, 0LL, std::plus<>()), static_cast<long long>(n) * (n - 1) / 2);
+	EXPECT_EQ(empty.reduce(adt::execution::par, 7, std::plus<>()), 7);
+}
+
+TEST(singly_list__methods, reduce__parallel__other_result_type) {
+	// Sums the lengths of strings: each segment starts from the length of its first string
+	struct length {
+		std::size_t value;
+
+		length(std::size_t value) : value(value) {}
+
+		length(const std::string& string) : value(string.size()) {}
+	};
+
+	struct add_lengths {
+		length operator()(length lhs, const std::string& rhs) const { return lhs.value + rhs.size(); }
+
+		length operator()(length lhs, length rhs) const { return lhs.value + rhs.value; }
+	};
+
+	adt::singly_list<std::string> list;
+	inline_executor executor;
+	const std::size_t n = 100'000;
+
+	for (std::size_t i = 0; i < n; i++) {
+		list.push_back(std::string(i % 10, 'a'));
+	}
+
+	EXPECT_EQ(list.reduce(executor, length(5), add_lengths()).value, 450'000 + 5);
+	EXPECT_EQ(executor.tasks, 4);
+}
+
+TEST(singly_list__methods, remove_if__parallel) {
+	adt::singly_list<int> list;
+	inline_executor executor;
+	const int n = 100'000;
+	int value = 1;
+
+	for (int i = 0; i < n; i++) {
+		list.push_back(i);
+	}
+
+	EXPECT_EQ(list.remove_if(executor, [](const int& element) -> bool { return element % 2 == 0; }), n / 2);
+
+	EXPECT_EQ(list.size(), n / 2);
+	for (int element : list) {
+		EXPECT_EQ(element, value);
+		value += 2;
+	}
+
+	// The tail must follow the last kept node
+	EXPECT_EQ(list.back(), n - 1);
+	list.push_back(-1);
+	EXPECT_EQ(list.back(), -1);
+
+	EXPECT_EQ(list.remove_if(adt::execution::par, [](const int&) -> bool { return true; }), n / 2 + 1);
+	EXPECT_TRUE(list.empty());
+	EXPECT_EQ(list.begin(), list.end());
+
+	list.push_back(1);
+	EXPECT_EQ(list.front(), 1);
+	EXPECT_EQ(list.back(), 1);
+}
+
+TEST(singly_list__methods, merge__filled_lists) {
+	adt::singly_list<int> list = {1, 4, 6, 9},
+						  other = {2, 3, 7, 10, 11};
+	std::initializer_list<int> matcher = {1, 2, 3, 4, 6, 7, 9, 10, 11};
+	const int* other_front = &other.front();
+
+	list.merge(other);
+
+	EXPECT_EQ(list, matcher);
+	EXPECT_EQ(list.size(), 9);
+	EXPECT_EQ(&*(list.begin() + 1), other_front);
+	EXPECT_TRUE(other.empty());
+
+	// The tail must follow the last merged node
+	list.push_back(12);
+	EXPECT_EQ(list.back(), 12);
+	EXPECT_EQ(list.size(), 10);
+}
+
+TEST(singly_list__methods, merge__tail_from_this) {
+	adt::singly_list<int> list = {1, 8},
+						  other = {2, 3};
+	std::initializer_list<int> matcher = {1, 2, 3, 8, 9};
+
+	list.merge(std::move(other));
+	list.push_back(9);
+
+	EXPECT_EQ(list, matcher);
+	other.push_back(1);
+	EXPECT_EQ(other.back(), 1);
+}
+
+TEST(singly_list__methods, merge__empty_lists) {
+	adt::singly_list<int> list,
+						  other = {1, 2};
+	std::initializer_list<int> matcher = {1, 2, 3};
+
+	list.merge(other);
+	list.merge(adt::singly_list<int>());
+	list.merge(list);
+	list.push_back(3);
+
+	EXPECT_EQ(list, matcher);
+	EXPECT_EQ(list.size(), 3);
+	EXPECT_TRUE(other.empty());
+}
+
+TEST(singly_list__methods, merge__stable_with_comparator) {
+	auto comp = [](const auto& lhs, const auto& rhs) -> bool { return lhs.first > rhs.first; };
+	adt::singly_list<std::pair<int, char>> list = {{3, 'a'}, {2, 'b'}, {1, 'c'}},
+										   other = {{3, 'd'}, {1, 'e'}, {0, 'f'}};
+	std::initializer_list<std::pair<int, char>> matcher = {{3, 'a'}, {3, 'd'}, {2, 'b'}, {1, 'c'}, {1, 'e'}, {0, 'f'}};
+
+	list.merge(other, comp);
+
+	EXPECT_EQ(list, matcher);
+	EXPECT_EQ(list.back(), std::make_pair(0, 'f'));
+}
+
+TEST(singly_list__methods, merge__unequal_allocator) {
+	int allocations = 0;
+	counting_allocator<int, false> allocator(1, &allocations),
+								   other_allocator(2, &allocations);
+	adt::singly_list<int, counting_allocator<int, false>> list({1, 3, 5}, allocator),
+														  other({2, 4}, other_allocator);
+	std::vector<int> matcher = {1, 2, 3, 4, 5};
+
+	list.merge(other);
+
+	EXPECT_TRUE(std::equal(list.begin(), list.end(), matcher.begin(), matcher.end()));
+	EXPECT_EQ(list.size(), 5);
+	EXPECT_EQ(list.back(), 5);
+	EXPECT_TRUE(other.empty());
+}
+
+TEST(singly_list__methods, for_each__filled) {
+	adt::singly_list<int> list = {1, 2, 3, 4, 5};
+	const adt::singly_list<int>& const_list = list;
+	std::initializer_list<int> matcher = {2, 4, 6, 8, 10};
+	std::vector<int> visited;
+
+	list.for_each([](int& value) -> void { value *= 2; });
+	const_list.for_each([&visited](const int& value) -> void { visited.push_back(value); });
+
+	EXPECT_EQ(list, matcher);
+	EXPECT_TRUE(std::equal(visited.begin(), visited.end(), matcher.begin(), matcher.end()));
+}
+
+TEST(singly_list__methods, for_each__prefetch_distance) {
+	adt::singly_list<int> list = {1, 2, 3};
+	int sum = 0;
+
+	// A distance longer than the list must not walk past its end
+	list.for_each<8>([&sum](int value) -> void { sum += value; });
+	EXPECT_EQ(sum, 6);
+
+	list.clear();
+	list.for_each<2>([&sum](int) -> void { sum = 0; });
+	EXPECT_EQ(sum, 6);
+}
+
+TEST(singly_list__methods, compact__filled) {
+	adt::singly_list<std::string> list = {"c", "a", "d", "b"};
+	std::initializer_list<std::string> matcher = {"a", "b", "c", "d", "e"};
+
+	list.sort();
+	list.compact();
+	list.push_back("e");
+
+	EXPECT_EQ(list, matcher);
+	EXPECT_EQ(list.size(), 5);
+	EXPECT_EQ(list.back(), "e");
+}
+
+TEST(singly_list__methods, compact__empty) {
+	adt::singly_list<int> list;
+
+	list.compact();
+	list.push_back(1);
+
+	EXPECT_EQ(list.size(), 1);
+	EXPECT_EQ(list.front(), 1);
+	EXPECT_EQ(list.back(), 1);
+}
+
+TEST(singly_list__methods, node_cache__disabled_by_default) {
+	adt::singly_list<int> list = {1, 2, 3};
+
+	list.clear();
+
+	EXPECT_EQ(list.node_cache_capacity(), ADT_SINGLY_LIST_NODE_CACHE_CAPACITY);
+	EXPECT_EQ(list.node_cache_size(), std::min<std::size_t>(3, ADT_SINGLY_LIST_NODE_CACHE_CAPACITY));
+}
+
+TEST(singly_list__methods, node_cache__clear_and_refill__no_allocations) {
+	int allocations = 0;
+	counting_allocator<int, false> allocator(1, &allocations);
+	adt::singly_list<int, counting_allocator<int, false>> list({1, 2, 3, 4, 5}, allocator);
+	std::initializer_list<int> matcher = {7, 6, 8, 9, 10};
+
+	list.set_node_cache_capacity(8);
+	list.clear();
+	EXPECT_EQ(list.node_cache_size(), 5);
+
+	// Every insertion reuses a cached node, whether one at a time or as a range
+	allocations = 0;
+	list.push_front(6);
+	list.push_front(7);
+	list.insert_after(std::next(list.cbegin()), {8, 9, 10});
+
+	EXPECT_EQ(allocations, 0);
+	EXPECT_EQ(list.node_cache_size(), 0);
+	EXPECT_EQ(list, matcher);
+
+	// Once the cache is empty, nodes come from the allocator again
+	list.push_back(11);
+	EXPECT_EQ(allocations, 1);
+}
+
+TEST(singly_list__methods, node_cache__bounded) {
+	adt::singly_list<int> list = {1, 2, 2, 3, 4, 5, 6, 7, 8};
+	std::initializer_list<int> matcher = {1, 3, 5};
+
+	list.set_node_cache_capacity(2);
+	list.unique();
+	list.remove_if([](int value) -> bool { return value % 2 == 0; });
+	list.resize(3);
+
+	EXPECT_EQ(list, matcher);
+	EXPECT_EQ(list.node_cache_size(), 2);
+}
+
+TEST(singly_list__methods, node_cache__destroys_values) {
+	adt::singly_list<std::string> list = {std::string(100, 'a'), std::string(100, 'b')};
+	std::initializer_list<std::string> matcher = {"c", "d"};
+
+	list.set_node_cache_capacity(4);
+	list.erase_after(list.cbefore_begin());
+	list.clear();
+	list.assign(matcher);
+
+	EXPECT_EQ(list, matcher);
+	EXPECT_EQ(list.node_cache_size(), 0);
+}
+
+TEST(singly_list__methods, set_node_cache_capacity__shrinks) {
+	adt::singly_list<int> list = {1, 2, 3, 4, 5, 6};
+
+	list.set_node_cache_capacity(8);
+	list.clear();
+	EXPECT_EQ(list.node_cache_size(), 6);
+
+	list.set_node_cache_capacity(3);
+	EXPECT_EQ(list.node_cache_size(), 3);
+	EXPECT_EQ(list.node_cache_capacity(), 3);
+}
+
+TEST(singly_list__methods, shrink_to_fit) {
+	adt::singly_list<int> list = {1, 2, 3};
+
+	list.set_node_cache_capacity(8);
+	list.pop_front();
+	list.pop_front();
+	list.shrink_to_fit();
+
+	EXPECT_EQ(list.node_cache_size(), 0);
+	EXPECT_EQ(list.node_cache_capacity(), 8);
+	EXPECT_EQ(list.front(), 3);
+
+	// The cache keeps working after being released
+	list.pop_front();
+	EXPECT_EQ(list.node_cache_size(), 1);
+}
+
 TEST(singly_list__methods, is_sorted__no_argument__empty_list) {
 	adt::singly_list<int> list;
 	EXPECT_FALSE(list.is_sorted());
@@ -0,0 +1,422 @@
+#ifndef SMALL_SINGLY_LIST_HPP
+#define SMALL_SINGLY_LIST_HPP
+
+#include <cstddef>
+#include <memory>
+#include <initializer_list>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <concepts>
+#include <utility>
+
+#include "singly_list.hpp"
+
+
+namespace adt {
+
+    // Hands out the slots of a buffer it does not own, one at a time. Freed slots are linked through their storage
+    class _inline_node_arena {
+    private:
+        /* ------------------------------------------------Slot----------------------------------------------------- */
+        struct _Slot {
+            /* --------------------------------------------Fields--------------------------------------------------- */
+            _Slot* next;
+        };
+
+        /* ------------------------------------------------Fields--------------------------------------------------- */
+        std::byte* first;
+
+        std::byte* last;
+
+        // Slots at or past `bump` have never been handed out
+        std::byte* bump;
+
+        _Slot* free_list;
+
+        // Number of slots handed out and not freed yet
+        std::size_t used;
+
+        std::size_t slot_size;
+
+        std::size_t slot_align;
+
+    public:
+        /* ----------------------------------------------Constructors----------------------------------------------- */
+        _inline_node_arena(std::byte* storage, std::size_t slot_size, std::size_t slot_align,
+                           std::size_t count) noexcept
+            : first(storage), last(storage + slot_size * count), bump(storage), free_list(nullptr), used(0),
+              slot_size(slot_size), slot_align(slot_align) {}
+
+        _inline_node_arena(const _inline_node_arena&) = delete;
+
+        _inline_node_arena(_inline_node_arena&&) = delete;
+
+        /* ------------------------------------------Overloaded Operators------------------------------------------- */
+        _inline_node_arena& operator=(const _inline_node_arena&) = delete;
+
+        _inline_node_arena& operator=(_inline_node_arena&&) = delete;
+
+        /* ------------------------------------------------Methods-------------------------------------------------- */
+        [[nodiscard]] std::size_t size() const noexcept { return this->used; }
+
+        [[nodiscard]] bool fits(std::size_t size, std::size_t align) const noexcept {
+            return size <= this->slot_size && this->slot_align % align == 0;
+        }
+
+        [[nodiscard]] bool owns(const void* ptr) const noexcept {
+            const std::byte* byte = static_cast<const std::byte*>(ptr);
+            return std::less_equal<const std::byte*>()(this->first, byte)
+                   && std::less<const std::byte*>()(byte, this->last);
+        }
+
+        // Returns a free slot, or nullptr if every slot is in use
+        [[nodiscard]] void* allocate() noexcept {
+            // Recycle a freed slot first
+            if (this->free_list != nullptr) {
+                _Slot* slot = this->free_list;
+                this->free_list = slot->next;
+                this->used++;
+                return slot;
+            }
+
+            if (this->bump == this->last) {
+                return nullptr;
+            }
+
+            void* slot = this->bump;
+            this->bump += this->slot_size;
+            this->used++;
+            return slot;
+        }
+
+        void deallocate(void* ptr) noexcept {
+            _Slot* slot = ::new (ptr) _Slot{this->free_list};
+            this->free_list = slot;
+            this->used--;
+        }
+
+    };
+
+    // Storage for `N` nodes, meant to be a base of the container that uses it so that it is constructed first and
+    // destroyed last
+    template<std::size_t SlotSize, std::size_t SlotAlign, std::size_t N>
+    class _inline_node_buffer {
+        static_assert(SlotSize >= sizeof(void*), "adt::_inline_node_buffer slots must be able to hold a pointer");
+
+    protected:
+        /* ------------------------------------------------Fields--------------------------------------------------- */
+        alignas(SlotAlign) alignas(void*) std::byte storage[N * SlotSize];
+
+        _inline_node_arena arena;
+
+        /* ----------------------------------------------Constructors----------------------------------------------- */
+        _inline_node_buffer() noexcept : arena(this->storage, SlotSize, SlotAlign, N) {}
+
+        _inline_node_buffer(const _inline_node_buffer&) = delete;
+
+        _inline_node_buffer(_inline_node_buffer&&) = delete;
+
+        /* -----------------------------------------------Destructor------------------------------------------------ */
+        ~_inline_node_buffer() noexcept = default;
+
+        /* ------------------------------------------Overloaded Operators------------------------------------------- */
+        _inline_node_buffer& operator=(const _inline_node_buffer&) = delete;
+
+        _inline_node_buffer& operator=(_inline_node_buffer&&) = delete;
+
+    };
+
+    // Allocates single objects from an inline buffer while it has room, and everything else from `Upstream`. Two
+    // allocators are equal only if they share the buffer (or both have none) and their upstream allocators are equal.
+    // The buffer never propagates, and copies made for a new container have none, so a container never ends up
+    // holding nodes that live inside another container
+    template<class T, class Upstream = std::allocator<T>>
+    class inline_node_allocator {
+    private:
+        /* ----------------------------------------------Definitions------------------------------------------------ */
+        using upstream_traits = std::allocator_traits<Upstream>;
+
+        /* ------------------------------------------------Friends-------------------------------------------------- */
+        template<class, class>
+        friend class inline_node_allocator;
+
+        /* ------------------------------------------------Fields--------------------------------------------------- */
+        _inline_node_arena* arena;
+
+        Upstream upstream;
+
+    public:
+        /* ----------------------------------------------Definitions------------------------------------------------ */
+        using value_type = T;
+
+        using size_type = std::size_t;
+
+        using difference_type = std::ptrdiff_t;
+
+        using upstream_allocator_type = Upstream;
+
+        using propagate_on_container_copy_assignment = std::false_type;
+
+        using propagate_on_container_move_assignment = std::false_type;
+
+        using propagate_on_container_swap = std::false_type;
+
+        using is_always_equal = std::false_type;
+
+        template<class U>
+        struct rebind {
+            using other = inline_node_allocator<U, typename upstream_traits::template rebind_alloc<U>>;
+        };
+
+        /* ----------------------------------------------Constructors----------------------------------------------- */
+        inline_node_allocator() noexcept : arena(nullptr) {}
+
+        explicit inline_node_allocator(_inline_node_arena* arena, const Upstream& upstream = Upstream()) noexcept
+            : arena(arena), upstream(upstream) {}
+
+        inline_node_allocator(const inline_node_allocator&) noexcept = default;
+
+        template<class U, class UpstreamU>
+        inline_node_allocator(const inline_node_allocator<U, UpstreamU>& other) noexcept
+            : arena(other.arena), upstream(other.upstream) {}
+
+        /* -----------------------------------------------Destructor------------------------------------------------ */
+        ~inline_node_allocator() noexcept = default;
+
+        /* ------------------------------------------Overloaded Operators------------------------------------------- */
+        inline_node_allocator& operator=(const inline_node_allocator&) noexcept = default;
+
+        template<class U, class UpstreamU>
+        [[nodiscard]] bool operator==(const inline_node_allocator<U, UpstreamU>& rhs) const noexcept {
+            return this->arena == rhs.arena && this->upstream == rhs.upstream;
+        }
+
+        /* ------------------------------------------------Methods-------------------------------------------------- */
+        [[nodiscard]] const upstream_allocator_type& upstream_allocator() const noexcept { return this->upstream; }
+
+        // Number of objects currently allocated in the inline buffer
+        [[nodiscard]] size_type inline_size() const noexcept {
+            return (this->arena != nullptr) ? this->arena->size() : 0;
+        }
+
+        // Whether `ptr` lives in the inline buffer
+        [[nodiscard]] bool owns(const void* ptr) const noexcept {
+            return this->arena != nullptr && this->arena->owns(ptr);
+        }
+
+        [[nodiscard]] inline_node_allocator select_on_container_copy_construction() const {
+            return inline_node_allocator(nullptr,
+                                         upstream_traits::select_on_container_copy_construction(this->upstream));
+        }
+
+        [[nodiscard]] T* allocate(size_type n) {
+            if (n == 1 && this->arena != nullptr && this->arena->fits(sizeof(T), alignof(T))) {
+                if (void* slot = this->arena->allocate()) {
+                    return static_cast<T*>(slot);
+                }
+            }
+
+            return upstream_traits::allocate(this->upstream, n);
+        }
+
+        void deallocate(T* ptr, size_type n) noexcept {
+            if (this->owns(ptr)) {
+                this->arena->deallocate(ptr);
+                return;
+            }
+
+            upstream_traits::deallocate(this->upstream, ptr, n);
+        }
+
+    };
+
+    // A singly_list that keeps its first `N` nodes inside the container object, next to the dummy head, and only
+    // allocates from `Allocator` beyond that. Lists that rarely grow past `N` elements then never allocate at all.
+    //
+    // Every singly_list operation is available and keeps its iterator semantics, with one caveat inherited from the
+    // buffer living in the object: nodes cannot change containers. Moving or swapping a small_singly_list moves the
+    // elements stored inline one by one (allocated nodes are still relinked), and splicing between two different
+    // containers moves every spliced element into a new node, as for any two unequal allocators. The same holds when
+    // assigning, swapping or splicing through a singly_list reference, since the allocators of two containers never
+    // compare equal; only those paths move every element rather than just the inline ones. Lists built from
+    // get_allocator() share the buffer and must not outlive the container
+    template<class T, std::size_t N, class Allocator = std::allocator<T>>
+    class small_singly_list
+        : private _inline_node_buffer<sizeof(typename singly_list<T, inline_node_allocator<T, Allocator>>::_Node),
+                                      alignof(typename singly_list<T, inline_node_allocator<T, Allocator>>::_Node), N>,
+          public singly_list<T, inline_node_allocator<T, Allocator>> {
+        static_assert(N > 0, "adt::small_singly_list must store at least one node inline");
+
+    private:
+        /* -----------------------------------------------Definitions----------------------------------------------- */
+        using _List = singly_list<T, inline_node_allocator<T, Allocator>>;
+
+        using _Node = typename _List::_Node;
+
+        using _Buffer = _inline_node_buffer<sizeof(_Node), alignof(_Node), N>;
+
+        using upstream_traits = std::allocator_traits<Allocator>;
+
+    public:
+        /* -----------------------------------------------Definitions----------------------------------------------- */
+        using value_type = T;
+
+        using allocator_type = typename _List::allocator_type;
+
+        using upstream_allocator_type = Allocator;
+
+        using size_type = typename _List::size_type;
+
+        using const_reference = typename _List::const_reference;
+
+        // Number of nodes stored in the container object itself
+        static constexpr size_type inline_capacity = N;
+
+    private:
+        /* ------------------------------------------------Methods-------------------------------------------------- */
+        // Takes every element of `other`, leaving it empty. `*this` must be empty. Nodes in the buffer of `other` have
+        // their elements moved into new nodes; the others are relinked if our upstream allocator can free them
+        void _take(small_singly_list& other) noexcept {
+            if (this->node_allocator.upstream_allocator() != other.node_allocator.upstream_allocator()) {
+                this->_move_elements(other);
+                return;
+            }
+
+            _Node* node = other.head->next,
+                 * next;
+            size_type remaining = other.node_allocator.inline_size();
+
+            // Slots of the buffer kept by the node cache of `other` are not in its chain
+            for (const typename _List::_FreeNode* free_node = other.free_nodes; free_node != nullptr;
+                 free_node = free_node->next) {
+                if (other.node_allocator.owns(free_node)) {
+                    remaining--;
+                }
+            }
+
+            // Walk only as far as the last node in the buffer of `other`
+            for (; remaining > 0 && node != nullptr; node = next) {
+                next = node->next;
+
+                if (other.node_allocator.owns(node)) {
+                    this->tail->next = this->_create_node(std::move(node->value));
+                    other._delete_node(node);
+                    remaining--;
+                } else {
+                    this->tail->next = node;
+                }
+
+                this->tail = this->tail->next;
+            }
+
+            // The rest of the chain is relinked at once
+            if (node != nullptr) {
+                this->tail->next = node;
+                this->tail = other.tail;
+            } else {
+                this->tail->next = nullptr;
+            }
+            this->sz = other.sz;
+
+            // Reset `other` to its empty state
+            other.head->next = nullptr;
+            other.tail = other.head;
+            other.sz = 0;
+        }
+
+    public:
+        /* ----------------------------------------------Constructors----------------------------------------------- */
+        small_singly_list() noexcept : small_singly_list(upstream_allocator_type()) {}
+
+        explicit small_singly_list(const upstream_allocator_type& upstream) noexcept
+            : _Buffer(), _List(allocator_type(&this->arena, upstream)) {}
+
+        small_singly_list(std::initializer_list<value_type> values,
+                          const upstream_allocator_type& upstream = upstream_allocator_type())
+            : _Buffer(), _List(values, allocator_type(&this->arena, upstream)) {}
+
+        explicit small_singly_list(size_type size, const upstream_allocator_type& upstream = upstream_allocator_type())
+            : _Buffer(), _List(allocator_type(&this->arena, upstream)) {
+            this->resize(size);
+        }
+
+        small_singly_list(size_type size, const_reference value,
+                          const upstream_allocator_type& upstream = upstream_allocator_type())
+            : _Buffer(), _List(size, value, allocator_type(&this->arena, upstream)) {}
+
+        template<std::input_iterator InputIt>
+        small_singly_list(InputIt first, InputIt last,
+                          const upstream_allocator_type& upstream = upstream_allocator_type())
+            : _Buffer(), _List(first, last, allocator_type(&this->arena, upstream)) {}
+
+        template<class R>
+        small_singly_list(std::from_range_t, R&& range,
+                          const upstream_allocator_type& upstream = upstream_allocator_type())
+            requires (std::convertible_to<std::ranges::range_reference_t<R>, value_type> && std::ranges::input_range<R>)
+            : _Buffer(), _List(std::from_range, std::forward<R>(range), allocator_type(&this->arena, upstream)) {}
+
+        small_singly_list(const small_singly_list& other)
+            : _Buffer(),
+              _List(other, allocator_type(&this->arena, upstream_traits::select_on_container_copy_construction(
+                  other.node_allocator.upstream_allocator()
+              ))) {}
+
+        small_singly_list(small_singly_list&& other) noexcept
+            : _Buffer(), _List(allocator_type(&this->arena, other.node_allocator.upstream_allocator())) {
+            this->_take(other);
+        }
+
+        /* -----------------------------------------------Destructor------------------------------------------------ */
+        ~small_singly_list() noexcept = default;
+
+        /* ------------------------------------------Overloaded Operators------------------------------------------- */
+        small_singly_list& operator=(const small_singly_list& rhs) {
+            // Protect against self-assignment
+            if (this != &rhs) {
+                this->assign(rhs.begin(), rhs.end());
+            }
+
+            return *this;
+        }
+
+        small_singly_list& operator=(small_singly_list&& rhs) noexcept {
+            // Protect against self-assignment
+            if (this != &rhs) {
+                this->_clear();
+                this->sz = 0;
+                this->_take(rhs);
+            }
+
+            return *this;
+        }
+
+        small_singly_list& operator=(std::initializer_list<value_type> values) {
+            this->assign(values);
+            return *this;
+        }
+
+        /* ------------------------------------------------Methods-------------------------------------------------- */
+        // Swaps the elements of both lists; like a move, elements stored inline are moved rather than relinked
+        void swap(small_singly_list& other) noexcept {
+            if (this == &other) {
+                return;
+            }
+
+            small_singly_list temp(std::move(other));
+            other = std::move(*this);
+            *this = std::move(temp);
+        }
+
+    };
+
+    /* ----------------------------------------Non-Member Functions------------------------------------------------- */
+    template<class T, std::size_t N, class Allocator>
+    void swap(small_singly_list<T, N, Allocator>& lhs, small_singly_list<T, N, Allocator>& rhs) noexcept {
+        lhs.swap(rhs);
+    }
+
+} // adt
+
+
+#endif // SMALL_SINGLY_LIST_HPP
@@ -0,0 +1,62 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <forward_list> // baseline to compare against
+
+#include "singly_list.hpp"
+#include "small_singly_list.hpp"
+
+
+/* -------------------------------------------Definitions---------------------------------------------------- */
+using value_type = int;
+
+/* ------------------------------------------Short-Lived Benchmarks------------------------------------------ */
+// Builds, walks and destroys a list of `n` elements per iteration, as request-scoped code does with its small lists
+template<class Container>
+static void bench_short_lived(benchmark::State& state) {
+	const std::size_t n = static_cast<std::size_t>(state.range(0));
+
+	for (auto _ : state) {
+		Container container;
+
+		for (std::size_t i = 0; i < n; i++) {
+			container.push_front(static_cast<value_type>(i));
+		}
+
+		std::int64_t sum = 0;
+		for (const value_type& value : container) {
+			sum += value;
+		}
+		benchmark::DoNotOptimize(sum);
+	}
+
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(bench_short_lived<adt::singly_list<value_type>>)->Name("short_lived<adt::singly_list>")
+	->DenseRange(0, 4)->Arg(8)->Arg(16);
+BENCHMARK(bench_short_lived<std::forward_list<value_type>>)->Name("short_lived<std::forward_list>")
+	->DenseRange(0, 4)->Arg(8)->Arg(16);
+BENCHMARK(bench_short_lived<adt::small_singly_list<value_type, 4>>)->Name("short_lived<adt::small_singly_list, 4>")
+	->DenseRange(0, 4)->Arg(8)->Arg(16);
+
+/* ---------------------------------------------Move Benchmarks---------------------------------------------- */
+// Moving a small list moves its inline elements one by one, where a singly_list only relinks its chain. The move walks
+// the chain up to the last inline node: here the first elements pushed, i.e. the back of the list
+template<class Container>
+static void bench_move(benchmark::State& state) {
+	const std::size_t n = static_cast<std::size_t>(state.range(0));
+	Container container;
+
+	for (std::size_t i = 0; i < n; i++) {
+		container.push_front(static_cast<value_type>(i));
+	}
+
+	for (auto _ : state) {
+		Container moved(std::move(container));
+		container = std::move(moved);
+		benchmark::DoNotOptimize(container);
+	}
+}
+BENCHMARK(bench_move<adt::singly_list<value_type>>)->Name("move<adt::singly_list>")->Arg(4)->Arg(1'000);
+BENCHMARK(bench_move<adt::small_singly_list<value_type, 4>>)->Name("move<adt::small_singly_list, 4>")
+	->Arg(4)->Arg(1'000);
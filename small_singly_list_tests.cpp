@@ -0,0 +1,338 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <memory> // to test move-only elements
+#include <vector>
+#include <algorithm>
+
+#include "small_singly_list.hpp"
+
+
+/* -------------------------------------------Definitions---------------------------------------------------- */
+namespace {
+
+	// Counts the calls to allocate() and deallocate() made by every copy of the allocator
+	template<class T>
+	struct counting_allocator {
+		using value_type = T;
+
+		static inline int allocations = 0;
+
+		static inline int deallocations = 0;
+
+		counting_allocator() = default;
+
+		template<class U>
+		counting_allocator(const counting_allocator<U>&) noexcept {}
+
+		T* allocate(std::size_t n) {
+			counting_allocator<char>::allocations++;
+			return std::allocator<T>().allocate(n);
+		}
+
+		void deallocate(T* ptr, std::size_t n) noexcept {
+			counting_allocator<char>::deallocations++;
+			std::allocator<T>().deallocate(ptr, n);
+		}
+
+		template<class U>
+		bool operator==(const counting_allocator<U>&) const noexcept { return true; }
+	};
+
+	using list_type = adt::small_singly_list<int, 4, counting_allocator<int>>;
+
+	using allocations = counting_allocator<char>;
+
+	// Counts the instances alive, to check that every element is destroyed
+	struct tracked {
+		static inline int alive = 0;
+
+		int value = 0;
+
+		tracked() { alive++; }
+
+		tracked(int value) : value(value) { alive++; }
+
+		tracked(const tracked& other) : value(other.value) { alive++; }
+
+		~tracked() { alive--; }
+	};
+
+	// Whether `value` is stored inside the container object
+	template<class List, class T>
+	bool is_inline(const List& list, const T& value) {
+		const auto* first = reinterpret_cast<const std::byte*>(&list);
+		const auto* byte = reinterpret_cast<const std::byte*>(&value);
+		return first <= byte && byte < first + sizeof(list);
+	}
+
+} // namespace
+
+/* -----------------------------------Small Singly List Constructors Tests----------------------------------- */
+TEST(small_singly_list__constructors, default_constructor) {
+	allocations::allocations = 0;
+	list_type list;
+
+	EXPECT_TRUE(list.empty());
+	EXPECT_EQ(list.size(), 0);
+	EXPECT_EQ(list.begin(), list.end());
+	EXPECT_EQ(allocations::allocations, 0);
+}
+
+TEST(small_singly_list__constructors, initializer_list_constructor__inline) {
+	allocations::allocations = 0;
+	list_type list = {1, 2, 3, 4};
+	std::vector<int> matcher = {1, 2, 3, 4};
+
+	EXPECT_TRUE(std::equal(list.begin(), list.end(), matcher.begin(), matcher.end()));
+	EXPECT_EQ(allocations::allocations, 0);
+
+	for (const int& value : list) {
+		EXPECT_TRUE(is_inline(list, value));
+	}
+}
+
+TEST(small_singly_list__constructors, initializer_list_constructor__spilled) {
+	allocations::allocations = 0;
+	list_type list = {1, 2, 3, 4, 5, 6};
+	std::vector<int> matcher = {1, 2, 3, 4, 5, 6};
+
+	EXPECT_TRUE(std::equal(list.begin(), list.end(), matcher.begin(), matcher.end()));
+	EXPECT_EQ(list.size(), 6);
+	EXPECT_EQ(allocations::allocations, 2);
+	EXPECT_FALSE(is_inline(list, list.back()));
+}
+
+TEST(small_singly_list__constructors, size_constructor) {
+	list_type list(3),
+			  filled(5, 7);
+
+	EXPECT_EQ(list, list_type({0, 0, 0}));
+	EXPECT_EQ(filled, list_type({7, 7, 7, 7, 7}));
+}
+
+TEST(small_singly_list__constructors, copy_constructor) {
+	list_type list = {1, 2, 3, 4, 5, 6},
+			  list_copy(list);
+
+	EXPECT_EQ(list, list_copy);
+	EXPECT_TRUE(is_inline(list_copy, list_copy.front()));
+	EXPECT_NE(list.get_allocator(), list_copy.get_allocator());
+}
+
+TEST(small_singly_list__constructors, move_constructor) {
+	list_type list = {1, 2, 3, 4, 5, 6};
+	const int* spilled = &list.back();
+
+	allocations::allocations = 0;
+	list_type list_move(std::move(list));
+
+	// Inline elements are moved into the new buffer, allocated nodes are relinked
+	EXPECT_EQ(allocations::allocations, 0);
+	EXPECT_TRUE(is_inline(list_move, list_move.front()));
+	EXPECT_EQ(&list_move.back(), spilled);
+
+	EXPECT_EQ(list_move, list_type({1, 2, 3, 4, 5, 6}));
+	EXPECT_TRUE(list.empty());
+
+	// The moved-from list can still use its whole buffer
+	list.push_front(1);
+	EXPECT_TRUE(is_inline(list, list.front()));
+}
+
+/* ------------------------------------Small Singly List Operators Tests------------------------------------- */
+TEST(small_singly_list__operators, copy_assignment) {
+	list_type list = {1, 2, 3, 4, 5},
+			  other = {9};
+
+	other = list;
+
+	EXPECT_EQ(other, list);
+	EXPECT_TRUE(is_inline(other, other.front()));
+	EXPECT_NE(&other.front(), &list.front());
+}
+
+TEST(small_singly_list__operators, move_assignment) {
+	list_type list = {1, 2, 3, 4, 5},
+			  other = {9, 8};
+
+	other = std::move(list);
+
+	EXPECT_EQ(other, list_type({1, 2, 3, 4, 5}));
+	EXPECT_TRUE(list.empty());
+	EXPECT_TRUE(is_inline(other, other.front()));
+
+	other = {1};
+	EXPECT_EQ(other, list_type({1}));
+}
+
+/* -------------------------------------Small Singly List Methods Tests-------------------------------------- */
+TEST(small_singly_list__methods, push_pop__reuses_buffer) {
+	list_type list;
+
+	allocations::allocations = 0;
+	for (int round = 0; round < 10; round++) {
+		for (int i = 0; i < 4; i++) {
+			list.push_front(i);
+		}
+		while (!list.empty()) {
+			list.pop_front();
+		}
+	}
+
+	EXPECT_EQ(allocations::allocations, 0);
+}
+
+TEST(small_singly_list__methods, spill__frees_upstream) {
+	allocations::allocations = 0;
+	allocations::deallocations = 0;
+	{
+		list_type list;
+		for (int i = 0; i < 10; i++) {
+			list.push_back(i);
+		}
+		EXPECT_EQ(allocations::allocations, 6);
+
+		// Freed inline slots are used again before the allocator
+		list.pop_front();
+		list.push_back(10);
+		EXPECT_EQ(allocations::allocations, 6);
+		EXPECT_TRUE(is_inline(list, list.back()));
+	}
+
+	EXPECT_EQ(allocations::deallocations, 6);
+}
+
+TEST(small_singly_list__methods, swap) {
+	list_type list = {1, 2},
+			  other = {3, 4, 5, 6, 7};
+
+	list.swap(other);
+	EXPECT_EQ(list, list_type({3, 4, 5, 6, 7}));
+	EXPECT_EQ(other, list_type({1, 2}));
+
+	swap(list, other);
+	EXPECT_EQ(list, list_type({1, 2}));
+	EXPECT_EQ(other, list_type({3, 4, 5, 6, 7}));
+	EXPECT_TRUE(is_inline(list, list.front()));
+	EXPECT_TRUE(is_inline(other, other.front()));
+}
+
+TEST(small_singly_list__methods, swap__through_base_reference) {
+	list_type list = {1, 2},
+			  other = {3, 4, 5, 6, 7};
+	adt::singly_list<int, list_type::allocator_type>& base = list;
+
+	// The buffers stay with their containers, so no node may change hands
+	base.swap(other);
+	EXPECT_EQ(list, list_type({3, 4, 5, 6, 7}));
+	EXPECT_EQ(other, list_type({1, 2}));
+	EXPECT_TRUE(is_inline(list, list.front()));
+	EXPECT_TRUE(is_inline(other, other.front()));
+
+	other.push_back(8);
+	EXPECT_EQ(other, list_type({1, 2, 8}));
+}
+
+TEST(small_singly_list__methods, splice_after__same_list) {
+	list_type list = {1, 2, 3, 4, 5, 6};
+	const int* moved = &list.front();
+
+	// Splicing within the list relinks the node, so references stay valid
+	list.splice_after(std::next(list.cbegin(), 5), list, list.cbefore_begin());
+
+	EXPECT_EQ(list, list_type({2, 3, 4, 5, 6, 1}));
+	EXPECT_EQ(&list.back(), moved);
+}
+
+TEST(small_singly_list__methods, splice_after__other_list) {
+	list_type list = {1, 2},
+			  other = {3, 4, 5, 6, 7};
+
+	list.splice_after(list.cbegin(), other);
+
+	EXPECT_EQ(list, list_type({1, 3, 4, 5, 6, 7, 2}));
+	EXPECT_TRUE(other.empty());
+
+	// The buffer of `other` is free again
+	other.push_front(1);
+	EXPECT_TRUE(is_inline(other, other.front()));
+}
+
+TEST(small_singly_list__methods, sort) {
+	list_type list = {5, 3, 6, 1, 4, 2};
+
+	list.sort();
+
+	EXPECT_EQ(list, list_type({1, 2, 3, 4, 5, 6}));
+}
+
+TEST(small_singly_list__methods, destructor__releases_elements) {
+	{
+		adt::small_singly_list<tracked, 2> list = {1, 2, 3},
+										   other(list);
+		list.pop_front();
+		other = std::move(list);
+	}
+
+	EXPECT_EQ(tracked::alive, 0);
+}
+
+TEST(small_singly_list__methods, emplace_front__move_only) {
+	adt::small_singly_list<std::unique_ptr<int>, 2> list;
+
+	list.emplace_front(std::make_unique<int>(1));
+	list.push_front(std::make_unique<int>(2));
+	list.push_front(std::make_unique<int>(3));
+
+	adt::small_singly_list<std::unique_ptr<int>, 2> other(std::move(list));
+
+	EXPECT_EQ(*other.front(), 3);
+	EXPECT_EQ(*other.back(), 1);
+	EXPECT_EQ(other.size(), 3);
+}
+
+TEST(small_singly_list__methods, move__inline_nodes_at_the_back) {
+	list_type list = {1, 2, 3, 4, 5, 6, 7};
+
+	// Free inline slots by popping the front, then refill them at the back
+	list.pop_front();
+	list.pop_front();
+	list.push_back(8);
+	list.push_back(9);
+	ASSERT_TRUE(is_inline(list, list.back()));
+
+	list_type other(std::move(list));
+
+	EXPECT_EQ(other, list_type({3, 4, 5, 6, 7, 8, 9}));
+	EXPECT_TRUE(is_inline(other, other.back()));
+	EXPECT_TRUE(list.empty());
+
+	other.push_back(10);
+	EXPECT_EQ(other.back(), 10);
+	EXPECT_EQ(other.size(), 8);
+}
+
+TEST(small_singly_list__methods, move__inline_nodes_in_node_cache) {
+	list_type list = {1, 2, 3, 4, 5, 6};
+	list.set_node_cache_capacity(4);
+	const int* spilled = &list.back();
+
+	// The popped inline slots stay in the node cache rather than in the chain
+	list.pop_front();
+	list.pop_front();
+	ASSERT_EQ(list.node_cache_size(), 2);
+
+	allocations::allocations = 0;
+	list_type other(std::move(list));
+
+	EXPECT_EQ(allocations::allocations, 0);
+	EXPECT_EQ(other, list_type({3, 4, 5, 6}));
+	EXPECT_TRUE(is_inline(other, other.front()));
+	EXPECT_EQ(&other.back(), spilled);
+	EXPECT_TRUE(list.empty());
+
+	// The cached slots are still reused by the moved-from list
+	list.push_front(1);
+	EXPECT_TRUE(is_inline(list, list.front()));
+}
@@ -0,0 +1,871 @@
+#ifndef UNROLLED_SINGLY_LIST_HPP
+#define UNROLLED_SINGLY_LIST_HPP
+
+#include <cstddef>
+#include <memory>
+#include <initializer_list>
+#include <stdexcept>
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <concepts>
+#include <string>
+#include <utility>
+
+
+namespace adt {
+
+    // Number of elements per node that keeps the element storage of a node within two cache lines
+    template<class T>
+    inline constexpr std::size_t unrolled_singly_list_default_capacity = (sizeof(T) < 64) ? 128 / sizeof(T) : 2;
+
+    // A singly linked list whose nodes each hold up to `N` contiguous elements, so that traversal touches one node
+    // header per `N` elements instead of one per element. The interface follows singly_list and std::forward_list.
+    //
+    // Unlike those, elements do not stay where they were constructed. insert_after, emplace_after, push_front,
+    // erase_after and pop_front shift the elements of the node they touch, split a full node in half, or merge a node
+    // that drops below half full into its successor; splice_after splits nodes at the range boundaries. Each of them
+    // invalidates iterators, pointers and references to the other elements of the nodes involved, even though those
+    // elements keep their values and order. Iterators to elements of untouched nodes stay valid
+    template<class T, std::size_t N = unrolled_singly_list_default_capacity<T>, class Allocator = std::allocator<T>>
+    class unrolled_singly_list {
+        static_assert(N > 0, "adt::unrolled_singly_list must store at least one element per node");
+
+    public:
+        /* -----------------------------------------------Definitions----------------------------------------------- */
+        using value_type = T;
+
+        using allocator_type = Allocator;
+
+        using size_type = std::size_t;
+
+        using difference_type = std::ptrdiff_t;
+
+        using reference = value_type&;
+
+        using const_reference = const value_type&;
+
+        using pointer = typename std::allocator_traits<allocator_type>::pointer;
+
+        using const_pointer = typename std::allocator_traits<allocator_type>::const_pointer;
+
+    private:
+        /* -------------------------------------------------Node---------------------------------------------------- */
+        struct _Node {
+            /* --------------------------------------------Fields--------------------------------------------------- */
+            _Node* next = nullptr;
+
+            size_type count = 0;
+
+            alignas(value_type) std::byte storage[N * sizeof(value_type)];
+
+            /* --------------------------------------------Methods-------------------------------------------------- */
+            [[nodiscard]] value_type* data() noexcept { return std::launder(reinterpret_cast<value_type*>(this->storage)); }
+
+            [[nodiscard]] const value_type* data() const noexcept {
+                return std::launder(reinterpret_cast<const value_type*>(this->storage));
+            }
+
+        };
+
+        /* ----------------------------------------------Definitions------------------------------------------------ */
+        using allocator_traits = typename std::allocator_traits<allocator_type>;
+
+        using _NodeAllocator = typename allocator_traits::template rebind_alloc<_Node>;
+
+        using node_allocator_traits = typename std::allocator_traits<_NodeAllocator>;
+
+        // Index used by the before-begin position
+        static constexpr size_type npos = std::numeric_limits<size_type>::max();
+
+        /* ------------------------------------------------Fields--------------------------------------------------- */
+        _Node* head;
+
+        _Node* tail;
+
+        allocator_type allocator;
+
+        _NodeAllocator node_allocator;
+
+        size_type sz;
+
+        /* ------------------------------------------------Methods-------------------------------------------------- */
+        _Node* _create_node() {
+            _Node* node = node_allocator_traits::allocate(this->node_allocator, 1);
+
+            // Default-initialized, so that only `next` and `count` are written and the element storage is left as is
+            ::new (static_cast<void*>(node)) _Node;
+            return node;
+        }
+
+        void _delete_node(_Node* node) noexcept {
+            // Destroy the elements still stored in the node
+            value_type* data = node->data();
+            for (size_type i = 0; i < node->count; i++) {
+                allocator_traits::destroy(this->allocator, data + i);
+            }
+
+            node_allocator_traits::destroy(this->node_allocator, node);
+            node_allocator_traits::deallocate(this->node_allocator, node, 1);
+        }
+
+        void _clear() noexcept {
+            _Node* node = this->head,
+                 * next;
+
+            while (node != nullptr) {
+                next = node->next;
+                this->_delete_node(node);
+                node = next;
+            }
+
+            this->head = nullptr;
+            this->tail = nullptr;
+            this->sz = 0;
+        }
+
+        [[nodiscard]] bool _is_allocator_equal(const unrolled_singly_list& other) const noexcept {
+            if constexpr (node_allocator_traits::is_always_equal::value) {
+                return true;
+            } else {
+                return this->node_allocator == other.node_allocator;
+            }
+        }
+
+        // Takes every node of `other` in O(1), leaving `other` empty. `*this` must be empty and its allocator must be
+        // able to free the nodes of `other`
+        void _steal(unrolled_singly_list& other) noexcept {
+            this->head = std::exchange(other.head, nullptr);
+            this->tail = std::exchange(other.tail, nullptr);
+            this->sz = std::exchange(other.sz, 0);
+        }
+
+        // Moves every element of `other` into nodes allocated by `*this`, then frees the nodes of `other`. `*this` must
+        // be empty
+        void _move_elements(unrolled_singly_list& other) {
+            for (_Node* node = other.head; node != nullptr; node = node->next) {
+                value_type* data = node->data();
+                for (size_type i = 0; i < node->count; i++) {
+                    this->push_back(std::move(data[i]));
+                }
+            }
+
+            other._clear();
+        }
+
+        // Returns the link that points to the node following `node`, where nullptr stands for the before-begin node
+        [[nodiscard]] _Node** _link_after(_Node* node) noexcept { return (node == nullptr) ? &this->head : &node->next; }
+
+        // Links a new, empty node after `node` (nullptr stands for the before-begin node)
+        _Node* _link_new_node(_Node* node) {
+            _Node* new_node = this->_create_node();
+            _Node** link = this->_link_after(node);
+
+            new_node->next = *link;
+            *link = new_node;
+
+            if (this->tail == node) {
+                this->tail = new_node;
+            }
+
+            return new_node;
+        }
+
+        // Moves the elements [`k`, `node->count`) of `node` into a new node linked right after it
+        _Node* _split(_Node* node, size_type k) {
+            _Node* new_node = this->_link_new_node(node);
+            value_type* src = node->data(),
+                      * dst = new_node->data();
+
+            for (size_type i = k; i < node->count; i++) {
+                allocator_traits::construct(this->allocator, dst + (i - k), std::move(src[i]));
+                allocator_traits::destroy(this->allocator, src + i);
+            }
+
+            new_node->count = node->count - k;
+            node->count = k;
+
+            return new_node;
+        }
+
+        // Constructs a new element at index `index` of `node`, shifting the elements after it one slot to the right
+        template<class... Args>
+        void _emplace_in_node(_Node* node, size_type index, Args&&... args) {
+            value_type* data = node->data();
+
+            allocator_traits::construct(this->allocator, data + node->count, std::forward<Args>(args)...);
+            std::rotate(data + index, data + node->count, data + node->count + 1);
+            node->count++;
+        }
+
+        // Constructs a new element right after the position (`node`, `index`); returns the position of the new element
+        template<class... Args>
+        std::pair<_Node*, size_type> _emplace_after(_Node* node, size_type index, Args&&... args) {
+            // Translate the position after (`node`, `index`) into a node and an index within that node
+            size_type target = (node == nullptr) ? 0 : index + 1;
+            if (node == nullptr) {
+                node = this->head;
+            }
+
+            // If the list is empty, or the new element goes at the end of a full node, start a new node
+            if (node == nullptr || (target == N && node->count == N)) {
+                node = this->_link_new_node(node);
+                target = 0;
+            } else if (node->count == N) {
+                // Otherwise, split a full node in half and insert into the half that `target` falls in. The split
+                // destroys the elements it moves, which `args` may refer to, so the new element is built first
+                value_type value(std::forward<Args>(args)...);
+                const size_type k = N / 2;
+                _Node* new_node = this->_split(node, k);
+
+                if (target > k) {
+                    node = new_node;
+                    target -= k;
+                }
+
+                this->_emplace_in_node(node, target, std::move(value));
+                this->sz++;
+
+                return {node, target};
+            }
+
+            this->_emplace_in_node(node, target, std::forward<Args>(args)...);
+            this->sz++;
+
+            return {node, target};
+        }
+
+        // Erases the element at (`node`, `index`), where `prev` is the node before `node` (nullptr for the before-begin
+        // node); returns the position of the element that followed the erased one
+        std::pair<_Node*, size_type> _erase(_Node* prev, _Node* node, size_type index) noexcept {
+            value_type* data = node->data();
+
+            // Shift the elements after `index` one slot to the left and destroy the vacated last slot
+            std::move(data + index + 1, data + node->count, data + index);
+            allocator_traits::destroy(this->allocator, data + node->count - 1);
+            node->count--;
+            this->sz--;
+
+            // Unlink the node once it is empty
+            if (node->count == 0) {
+                _Node* next = node->next;
+
+                *this->_link_after(prev) = next;
+                if (this->tail == node) {
+                    this->tail = prev;
+                }
+
+                node_allocator_traits::destroy(this->node_allocator, node);
+                node_allocator_traits::deallocate(this->node_allocator, node, 1);
+
+                return {next, 0};
+            }
+
+            // Merge the next node into `node` once `node` is less than half full and both fit in a single node
+            _Node* next = node->next;
+            if (next != nullptr && node->count < N / 2 && node->count + next->count <= N) {
+                value_type* src = next->data();
+
+                for (size_type i = 0; i < next->count; i++) {
+                    allocator_traits::construct(this->allocator, data + node->count + i, std::move(src[i]));
+                    allocator_traits::destroy(this->allocator, src + i);
+                }
+                node->count += next->count;
+                next->count = 0;
+
+                node->next = next->next;
+                if (this->tail == next) {
+                    this->tail = node;
+                }
+                this->_delete_node(next);
+            }
+
+            return (index < node->count) ? std::pair<_Node*, size_type>{node, index}
+                                         : std::pair<_Node*, size_type>{node->next, 0};
+        }
+
+    public:
+        /* --------------------------------------------Constant Iterator-------------------------------------------- */
+        class const_iterator {
+        private:
+            /* ---------------------------------------------Fields-------------------------------------------------- */
+            const unrolled_singly_list* parent;
+
+            const _Node* node;
+
+            std::size_t index;
+
+            /* -------------------------------------------Constructors---------------------------------------------- */
+            constexpr const_iterator(const unrolled_singly_list* parent, const _Node* node, std::size_t index) noexcept
+                : parent(parent), node(node), index(index) {}
+
+            /* --------------------------------------------Methods-------------------------------------------------- */
+            [[nodiscard]] constexpr bool _is_before_begin() const noexcept {
+                return this->node == nullptr && this->index == npos;
+            }
+
+            /* ---------------------------------------------Friends------------------------------------------------- */
+            friend class unrolled_singly_list;
+
+        public:
+            /* -------------------------------------------Definitions----------------------------------------------- */
+            using iterator_category = std::forward_iterator_tag;
+
+            using value_type = typename unrolled_singly_list::value_type;
+
+            using size_type = typename unrolled_singly_list::size_type;
+
+            using difference_type = typename unrolled_singly_list::difference_type;
+
+            using reference = const value_type&;
+
+            using pointer = const value_type*;
+
+            /* ------------------------------------------Constructors----------------------------------------------- */
+            constexpr const_iterator() noexcept : parent(nullptr), node(nullptr), index(0) {}
+
+            /* ---------------------------------------Overloaded Operators------------------------------------------ */
+            [[nodiscard]] reference operator*() const {
+                if (this->node == nullptr) {
+                    throw std::runtime_error("segmentation fault");
+                }
+                return this->node->data()[this->index];
+            }
+
+            [[nodiscard]] pointer operator->() const {
+                if (this->node == nullptr) {
+                    throw std::runtime_error("segmentation fault");
+                }
+                return this->node->data() + this->index;
+            }
+
+            const_iterator& operator++() {
+                if (this->_is_before_begin()) {
+                    this->node = this->parent->head;
+                    this->index = 0;
+                    return *this;
+                }
+
+                if (this->node == nullptr) {
+                    throw std::runtime_error("segmentation fault");
+                }
+
+                if (++this->index == this->node->count) {
+                    this->node = this->node->next;
+                    this->index = 0;
+                }
+                return *this;
+            }
+
+            const_iterator operator++(int) {
+                const_iterator temp = *this;
+                ++(*this);
+                return temp;
+            }
+
+            [[nodiscard]] const_iterator operator+(size_type n) const {
+                const_iterator it = *this;
+                for (size_type i = 0; i < n; i++) {
+                    ++it;
+                }
+                return it;
+            }
+
+            [[nodiscard]] constexpr bool operator==(const const_iterator& rhs) const noexcept {
+                return this->node == rhs.node && this->index == rhs.index;
+            }
+
+        };
+
+        /* ------------------------------------------------Iterator------------------------------------------------- */
+        class iterator {
+        private:
+            /* ---------------------------------------------Fields-------------------------------------------------- */
+            const unrolled_singly_list* parent;
+
+            _Node* node;
+
+            std::size_t index;
+
+            /* -------------------------------------------Constructors---------------------------------------------- */
+            constexpr iterator(const unrolled_singly_list* parent, _Node* node, std::size_t index) noexcept
+                : parent(parent), node(node), index(index) {}
+
+            /* ---------------------------------------------Friends------------------------------------------------- */
+            friend class unrolled_singly_list;
+
+        public:
+            /* -------------------------------------------Definitions----------------------------------------------- */
+            using iterator_category = std::forward_iterator_tag;
+
+            using value_type = typename unrolled_singly_list::value_type;
+
+            using size_type = typename unrolled_singly_list::size_type;
+
+            using difference_type = typename unrolled_singly_list::difference_type;
+
+            using reference = value_type&;
+
+            using pointer = value_type*;
+
+            /* ------------------------------------------Constructors----------------------------------------------- */
+            constexpr iterator() noexcept : parent(nullptr), node(nullptr), index(0) {}
+
+            /* ---------------------------------------Overloaded Operators------------------------------------------ */
+            [[nodiscard]] reference operator*() const {
+                if (this->node == nullptr) {
+                    throw std::runtime_error("segmentation fault");
+                }
+                return this->node->data()[this->index];
+            }
+
+            [[nodiscard]] pointer operator->() const {
+                if (this->node == nullptr) {
+                    throw std::runtime_error("segmentation fault");
+                }
+                return this->node->data() + this->index;
+            }
+
+            iterator& operator++() {
+                if (this->node == nullptr && this->index == npos) {
+                    this->node = this->parent->head;
+                    this->index = 0;
+                    return *this;
+                }
+
+                if (this->node == nullptr) {
+                    throw std::runtime_error("segmentation fault");
+                }
+
+                if (++this->index == this->node->count) {
+                    this->node = this->node->next;
+                    this->index = 0;
+                }
+                return *this;
+            }
+
+            iterator operator++(int) {
+                iterator temp = *this;
+                ++(*this);
+                return temp;
+            }
+
+            [[nodiscard]] iterator operator+(size_type n) const {
+                iterator it = *this;
+                for (size_type i = 0; i < n; i++) {
+                    ++it;
+                }
+                return it;
+            }
+
+            [[nodiscard]] constexpr bool operator==(const iterator& rhs) const noexcept {
+                return this->node == rhs.node && this->index == rhs.index;
+            }
+
+            [[nodiscard]] constexpr operator const_iterator() const noexcept {
+                return const_iterator(this->parent, this->node, this->index);
+            }
+
+        };
+
+    private:
+        /* ------------------------------------------------Methods-------------------------------------------------- */
+        void _check_position(const const_iterator& pos, const char* method) const {
+            if (pos.node == nullptr && !pos._is_before_begin()) {
+                throw std::runtime_error("segmentation fault");
+            }
+
+            if (pos.parent != this) {
+                throw std::invalid_argument(
+                    std::string(method) +
+                    "() error: \"pos\" must belong to the same instance of adt::unrolled_singly_list as *this"
+                );
+            }
+        }
+
+        // Splits the node of `pos` right after it so that the next position starts a node; `others` are positions in
+        // the same list that are re-targeted if the split moves their element
+        template<class... Positions>
+        void _split_after(const_iterator& pos, Positions&... others) {
+            if (pos._is_before_begin() || pos.index + 1 == pos.node->count) {
+                return;
+            }
+
+            _Node* node = const_cast<_Node*>(pos.node);
+            const size_type k = pos.index + 1;
+            _Node* new_node = this->_split(node, k);
+
+            // Re-target every other position whose element moved into the new node
+            ([&](const_iterator& other) -> void {
+                if (other.node == node && !other._is_before_begin() && other.index >= k) {
+                    other.node = new_node;
+                    other.index -= k;
+                }
+            }(others), ...);
+        }
+
+        void _splice_after(const_iterator pos, unrolled_singly_list& other, const_iterator first, const_iterator last) {
+            // Return if the range (`first`, `last`) is empty
+            if (first + 1 == last) {
+                return;
+            }
+
+            // If the allocators differ, the nodes cannot change owners, so the elements are moved into nodes of `*this`
+            // and then erased from `other`
+            if (!this->_is_allocator_equal(other)) {
+                const_iterator it = pos;
+                for (const_iterator curr = first + 1; curr != last; ++curr) {
+                    it = this->insert_after(it, std::move(const_cast<reference>(*curr)));
+                }
+
+                other.erase_after(first, last);
+                return;
+            }
+
+            // Make `last` start a node, `first` end a node, and `pos` end a node, so whole nodes can be relinked
+            if (last.node != nullptr && last.index > 0) {
+                const_iterator before_last(last.parent, last.node, last.index - 1);
+                other._split_after(before_last, last, first, pos);
+            }
+            other._split_after(first, last, pos);
+            this->_split_after(pos, first, last);
+
+            // Find the first and last nodes of the range and count the elements being moved
+            _Node* range_first = *other._link_after(const_cast<_Node*>(first.node)),
+                 * range_last = range_first;
+            size_type count = range_first->count;
+
+            while (range_last->next != nullptr && range_last->next != last.node) {
+                range_last = range_last->next;
+                count += range_last->count;
+            }
+
+            // Unlink the range from `other`
+            *other._link_after(const_cast<_Node*>(first.node)) = range_last->next;
+            if (other.tail == range_last) {
+                other.tail = const_cast<_Node*>(first.node);
+            }
+            other.sz -= count;
+
+            // Link the range in after `pos`
+            _Node** link = this->_link_after(const_cast<_Node*>(pos.node));
+            range_last->next = *link;
+            *link = range_first;
+            if (this->tail == pos.node) {
+                this->tail = range_last;
+            }
+            this->sz += count;
+        }
+
+    public:
+        /* ----------------------------------------------Constructors----------------------------------------------- */
+        unrolled_singly_list() noexcept : head(nullptr), tail(nullptr), sz(0) {}
+
+        explicit unrolled_singly_list(const allocator_type& allocator) noexcept
+            : head(nullptr), tail(nullptr), allocator(allocator), node_allocator(allocator), sz(0) {}
+
+        unrolled_singly_list(std::initializer_list<value_type> values, const allocator_type& allocator = allocator_type())
+            : unrolled_singly_list(allocator) {
+            for (const_reference value : values) {
+                this->push_back(value);
+            }
+        }
+
+        template<std::input_iterator InputIt>
+        unrolled_singly_list(InputIt first, InputIt last, const allocator_type& allocator = allocator_type())
+            : unrolled_singly_list(allocator) {
+            for (InputIt it = first; it != last; ++it) {
+                this->push_back(*it);
+            }
+        }
+
+        unrolled_singly_list(const unrolled_singly_list& other)
+            : unrolled_singly_list(allocator_traits::select_on_container_copy_construction(other.allocator)) {
+            for (const_reference value : other) {
+                this->push_back(value);
+            }
+        }
+
+        unrolled_singly_list(unrolled_singly_list&& other) noexcept
+            : head(other.head), tail(other.tail), allocator(std::move(other.allocator)),
+              node_allocator(std::move(other.node_allocator)), sz(other.sz) {
+            other.head = nullptr;
+            other.tail = nullptr;
+            other.sz = 0;
+        }
+
+        /* -----------------------------------------------Destructor------------------------------------------------ */
+        ~unrolled_singly_list() noexcept { this->_clear(); }
+
+        /* ------------------------------------------Overloaded Operators------------------------------------------- */
+        unrolled_singly_list& operator=(const unrolled_singly_list& rhs) {
+            // Protect against self-assignment
+            if (this == &rhs) {
+                return *this;
+            }
+
+            // Delete the nodes with the allocator that created them, before it may be replaced
+            this->_clear();
+
+            if constexpr (allocator_traits::propagate_on_container_copy_assignment::value) {
+                this->allocator = rhs.allocator;
+                this->node_allocator = rhs.node_allocator;
+            }
+
+            for (const_reference value : rhs) {
+                this->push_back(value);
+            }
+
+            return *this;
+        }
+
+        unrolled_singly_list& operator=(unrolled_singly_list&& rhs)
+            noexcept(allocator_traits::propagate_on_container_move_assignment::value ||
+                     allocator_traits::is_always_equal::value) {
+            // Protect against self-assignment
+            if (this == &rhs) {
+                return *this;
+            }
+
+            // Delete the nodes with the allocator that created them
+            this->_clear();
+
+            if constexpr (allocator_traits::propagate_on_container_move_assignment::value) {
+                // Take over the allocator of `rhs` along with its nodes
+                this->allocator = rhs.allocator;
+                this->node_allocator = rhs.node_allocator;
+                this->_steal(rhs);
+            } else if (this->_is_allocator_equal(rhs)) {
+                this->_steal(rhs);
+            } else {
+                // The nodes of `rhs` cannot be freed by our allocator, so only their elements can move
+                this->_move_elements(rhs);
+            }
+
+            return *this;
+        }
+
+        [[nodiscard]] bool operator==(const unrolled_singly_list& rhs) const {
+            return this->sz == rhs.sz && std::equal(this->cbegin(), this->cend(), rhs.cbegin());
+        }
+
+        /* ------------------------------------------------Methods-------------------------------------------------- */
+        [[nodiscard]] const_iterator cbefore_begin() const noexcept { return const_iterator(this, nullptr, npos); }
+
+        [[nodiscard]] const_iterator cbegin() const noexcept { return const_iterator(this, this->head, 0); }
+
+        [[nodiscard]] const_iterator cend() const noexcept { return const_iterator(this, nullptr, 0); }
+
+        [[nodiscard]] const_iterator before_begin() const noexcept { return this->cbefore_begin(); }
+
+        [[nodiscard]] const_iterator begin() const noexcept { return this->cbegin(); }
+
+        [[nodiscard]] const_iterator end() const noexcept { return this->cend(); }
+
+        [[nodiscard]] iterator before_begin() noexcept { return iterator(this, nullptr, npos); }
+
+        [[nodiscard]] iterator begin() noexcept { return iterator(this, this->head, 0); }
+
+        [[nodiscard]] iterator end() noexcept { return iterator(this, nullptr, 0); }
+
+        [[nodiscard]] allocator_type get_allocator() const noexcept { return this->allocator; }
+
+        [[nodiscard]] reference front() {
+            if (this->head != nullptr) {
+                return this->head->data()[0];
+            }
+            throw std::runtime_error("segmentation fault");
+        }
+
+        [[nodiscard]] const_reference front() const {
+            if (this->head != nullptr) {
+                return this->head->data()[0];
+            }
+            throw std::runtime_error("segmentation fault");
+        }
+
+        [[nodiscard]] reference back() {
+            if (this->tail != nullptr) {
+                return this->tail->data()[this->tail->count - 1];
+            }
+            throw std::runtime_error("segmentation fault");
+        }
+
+        [[nodiscard]] const_reference back() const {
+            if (this->tail != nullptr) {
+                return this->tail->data()[this->tail->count - 1];
+            }
+            throw std::runtime_error("segmentation fault");
+        }
+
+        [[nodiscard]] size_type size() const noexcept { return this->sz; }
+
+        [[nodiscard]] constexpr size_type max_size() const noexcept {
+            return std::numeric_limits<difference_type>::max();
+        }
+
+        [[nodiscard]] static constexpr size_type node_capacity() noexcept { return N; }
+
+        [[nodiscard]] bool empty() const noexcept { return this->sz == 0; }
+
+        void clear() noexcept { this->_clear(); }
+
+        iterator insert_after(const_iterator pos, const_reference value) {
+            return this->emplace_after(pos, value);
+        }
+
+        iterator insert_after(const_iterator pos, value_type&& value) {
+            return this->emplace_after(pos, std::move(value));
+        }
+
+        iterator insert_after(const_iterator pos, std::initializer_list<value_type> values) {
+            this->_check_position(pos, "insert_after");
+
+            iterator it(this, const_cast<_Node*>(pos.node), pos.index);
+            for (const_reference value : values) {
+                auto [node, index] = this->_emplace_after(it.node, it.index, value);
+                it = iterator(this, node, index);
+            }
+
+            return it;
+        }
+
+        template<class... Args>
+        iterator emplace_after(const_iterator pos, Args&&... args)
+            requires (std::constructible_from<value_type, Args...>) {
+            this->_check_position(pos, "emplace_after");
+
+            auto [node, index] = this->_emplace_after(const_cast<_Node*>(pos.node), pos.index, std::forward<Args>(args)...);
+            return iterator(this, node, index);
+        }
+
+        iterator erase_after(const_iterator pos) {
+            this->_check_position(pos, "erase_after");
+
+            _Node* node = const_cast<_Node*>(pos.node);
+
+            // If the element after `pos` lives in the same node...
+            if (!pos._is_before_begin() && pos.index + 1 < node->count) {
+                auto [next, index] = this->_erase(nullptr, node, pos.index + 1);
+                return iterator(this, next, index);
+            }
+
+            // Otherwise, it is the first element of the following node
+            _Node* next = *this->_link_after(node);
+            if (next == nullptr) {
+                throw std::runtime_error("segmentation fault");
+            }
+
+            auto [after, index] = this->_erase(node, next, 0);
+            return iterator(this, after, index);
+        }
+
+        iterator erase_after(const_iterator first, const_iterator last) {
+            this->_check_position(first, "erase_after");
+
+            // Count the elements in (`first`, `last`) up front, since erasing shifts elements between positions
+            size_type count = 0;
+            for (const_iterator it = first + 1; it != last; ++it) {
+                count++;
+            }
+
+            iterator it(this, const_cast<_Node*>(first.node), first.index);
+            for (size_type i = 0; i < count; i++) {
+                it = this->erase_after(first);
+            }
+
+            return (count == 0) ? iterator(this, const_cast<_Node*>(last.node), last.index) : it;
+        }
+
+        void splice_after(const_iterator pos, unrolled_singly_list& other) {
+            this->_check_position(pos, "splice_after");
+
+            // If `*this` and `other` are the same instance...
+            if (this == &other) {
+                throw std::invalid_argument("splice_after() error: \"other\" and \"*this\" cannot be from the same instance");
+            }
+
+            if (other.head == nullptr) {
+                return;
+            }
+
+            this->_splice_after(pos, other, other.cbefore_begin(), other.cend());
+        }
+
+        void splice_after(const_iterator pos, unrolled_singly_list&& other) { this->splice_after(pos, other); }
+
+        void splice_after(const_iterator pos, unrolled_singly_list& other, const_iterator it) {
+            this->_check_position(pos, "splice_after");
+
+            // Splicing an element after itself or after its own predecessor leaves the list unchanged
+            if (this == &other && (pos == it || pos == it + 1)) {
+                return;
+            }
+
+            this->_splice_after(pos, other, it, it + 2);
+        }
+
+        void splice_after(const_iterator pos, unrolled_singly_list&& other, const_iterator it) {
+            this->splice_after(pos, other, it);
+        }
+
+        void splice_after(const_iterator pos, unrolled_singly_list& other, const_iterator first, const_iterator last) {
+            this->_check_position(pos, "splice_after");
+            this->_splice_after(pos, other, first, last);
+        }
+
+        void splice_after(const_iterator pos, unrolled_singly_list&& other, const_iterator first, const_iterator last) {
+            this->splice_after(pos, other, first, last);
+        }
+
+        void push_front(const_reference value) { this->_emplace_after(nullptr, npos, value); }
+
+        void push_front(value_type&& value) { this->_emplace_after(nullptr, npos, std::move(value)); }
+
+        void push_back(const_reference value) { this->emplace_back(value); }
+
+        void push_back(value_type&& value) { this->emplace_back(std::move(value)); }
+
+        template<class... Args>
+        reference emplace_front(Args&&... args) {
+            auto [node, index] = this->_emplace_after(nullptr, npos, std::forward<Args>(args)...);
+            return node->data()[index];
+        }
+
+        template<class... Args>
+        reference emplace_back(Args&&... args) {
+            auto [node, index] = (this->tail == nullptr)
+                ? this->_emplace_after(nullptr, npos, std::forward<Args>(args)...)
+                : this->_emplace_after(this->tail, this->tail->count - 1, std::forward<Args>(args)...);
+            return node->data()[index];
+        }
+
+        void pop_front() {
+            // Check if the list is empty
+            if (this->head == nullptr) {
+                throw std::runtime_error("cannot pop from an empty list");
+            }
+
+            this->_erase(nullptr, this->head, 0);
+        }
+
+        // Exchanges the nodes of both lists in O(1). Unless the allocator propagates on swap, both allocators must
+        // compare equal, as for the standard containers
+        void swap(unrolled_singly_list& other) noexcept {
+            if constexpr (allocator_traits::propagate_on_container_swap::value) {
+                std::swap(this->allocator, other.allocator);
+                std::swap(this->node_allocator, other.node_allocator);
+            }
+
+            std::swap(this->head, other.head);
+            std::swap(this->tail, other.tail);
+            std::swap(this->sz, other.sz);
+        }
+
+    };
+
+} // adt
+
+
+#endif // UNROLLED_SINGLY_LIST_HPP
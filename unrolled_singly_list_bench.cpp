@@ -0,0 +1,62 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <forward_list> // baseline to compare against
+
+#include "singly_list.hpp"
+#include "unrolled_singly_list.hpp"
+
+
+/* -------------------------------------------Definitions---------------------------------------------------- */
+using value_type = int;
+
+/* -------------------------------------------Traversal Benchmarks------------------------------------------- */
+template<class Container>
+static void bench_traversal(benchmark::State& state) {
+	const std::size_t n = static_cast<std::size_t>(state.range(0));
+	Container container;
+
+	for (std::size_t i = 0; i < n; i++) {
+		container.push_front(static_cast<value_type>(i));
+	}
+
+	for (auto _ : state) {
+		std::int64_t sum = 0;
+		for (const value_type& value : container) {
+			sum += value;
+		}
+		benchmark::DoNotOptimize(sum);
+	}
+
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+	state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0) * sizeof(value_type));
+}
+BENCHMARK(bench_traversal<adt::singly_list<value_type>>)->Name("traversal<adt::singly_list>")
+	->RangeMultiplier(10)->Range(1'000, 10'000'000);
+BENCHMARK(bench_traversal<std::forward_list<value_type>>)->Name("traversal<std::forward_list>")
+	->RangeMultiplier(10)->Range(1'000, 10'000'000);
+BENCHMARK(bench_traversal<adt::unrolled_singly_list<value_type>>)->Name("traversal<adt::unrolled_singly_list>")
+	->RangeMultiplier(10)->Range(1'000, 10'000'000);
+BENCHMARK(bench_traversal<adt::unrolled_singly_list<value_type, 14>>)->Name("traversal<adt::unrolled_singly_list, 14>")
+	->RangeMultiplier(10)->Range(1'000, 10'000'000);
+
+/* -------------------------------------------Insertion Benchmarks------------------------------------------- */
+template<class Container>
+static void bench_push_front(benchmark::State& state) {
+	const std::size_t n = static_cast<std::size_t>(state.range(0));
+
+	for (auto _ : state) {
+		Container container;
+
+		for (std::size_t i = 0; i < n; i++) {
+			container.push_front(static_cast<value_type>(i));
+		}
+		benchmark::DoNotOptimize(container.front());
+	}
+
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(bench_push_front<adt::singly_list<value_type>>)->Name("push_front<adt::singly_list>")
+	->RangeMultiplier(10)->Range(1'000, 1'000'000);
+BENCHMARK(bench_push_front<adt::unrolled_singly_list<value_type>>)->Name("push_front<adt::unrolled_singly_list>")
+	->RangeMultiplier(10)->Range(1'000, 1'000'000);
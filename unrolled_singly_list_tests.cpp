@@ -0,0 +1,469 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <memory> // to test move-only elements
+#include <vector>
+#include <string>
+
+#include "unrolled_singly_list.hpp"
+
+
+/* -------------------------------------------Definitions---------------------------------------------------- */
+// A small node capacity so that every test crosses several node boundaries
+using list_type = adt::unrolled_singly_list<int, 4>;
+
+namespace {
+
+	// A stateful allocator that counts the nodes it allocates and frees; instances compare equal only when they share
+	// the same `id`, and propagate on copy, move and swap only if `Propagate` is true
+	template<class T, bool Propagate>
+	struct counting_allocator {
+		using value_type = T;
+
+		using propagate_on_container_copy_assignment = std::bool_constant<Propagate>;
+
+		using propagate_on_container_move_assignment = std::bool_constant<Propagate>;
+
+		using propagate_on_container_swap = std::bool_constant<Propagate>;
+
+		using is_always_equal = std::false_type;
+
+		template<class U>
+		struct rebind {
+			using other = counting_allocator<U, Propagate>;
+		};
+
+		int id;
+
+		int* live;
+
+		counting_allocator(int id, int* live) : id(id), live(live) {}
+
+		template<class U>
+		counting_allocator(const counting_allocator<U, Propagate>& other) : id(other.id), live(other.live) {}
+
+		T* allocate(std::size_t n) {
+			(*this->live)++;
+			return std::allocator<T>().allocate(n);
+		}
+
+		void deallocate(T* ptr, std::size_t n) {
+			(*this->live)--;
+			std::allocator<T>().deallocate(ptr, n);
+		}
+
+		template<class U>
+		bool operator==(const counting_allocator<U, Propagate>& rhs) const { return this->id == rhs.id; }
+	};
+
+	template<bool Propagate>
+	using counted_list_type = adt::unrolled_singly_list<int, 4, counting_allocator<int, Propagate>>;
+
+} // namespace
+
+/* ----------------------------------Unrolled Singly List Constructors Tests--------------------------------- */
+TEST(unrolled_singly_list__constructors, default_constructor) {
+	list_type list;
+
+	EXPECT_TRUE(list.empty());
+	EXPECT_EQ(list.size(), 0);
+	EXPECT_EQ(list.begin(), list.end());
+	EXPECT_THROW(static_cast<void>(list.front()), std::runtime_error);
+}
+
+TEST(unrolled_singly_list__constructors, initializer_list_constructor) {
+	list_type list = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+	std::vector<int> matcher = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+	EXPECT_EQ(list.size(), 9);
+	EXPECT_TRUE(std::equal(list.begin(), list.end(), matcher.begin(), matcher.end()));
+	EXPECT_EQ(list.front(), 1);
+	EXPECT_EQ(list.back(), 9);
+}
+
+TEST(unrolled_singly_list__constructors, copy_constructor) {
+	list_type list = {1, 2, 3, 4, 5, 6},
+			  list_copy(list);
+
+	EXPECT_EQ(list, list_copy);
+	EXPECT_NE(&list.front(), &list_copy.front());
+}
+
+TEST(unrolled_singly_list__constructors, move_constructor) {
+	list_type list_src = {1, 2, 3, 4, 5, 6};
+	const int* front = &list_src.front();
+
+	list_type list_dst = std::move(list_src);
+
+	EXPECT_TRUE(list_src.empty());
+	EXPECT_EQ(list_dst.size(), 6);
+	EXPECT_EQ(&list_dst.front(), front);
+}
+
+/* -----------------------------------Unrolled Singly List Operators Tests----------------------------------- */
+TEST(unrolled_singly_list__operators, move_assignment__propagating_allocator) {
+	int src_live = 0,
+		dst_live = 0;
+	{
+		counted_list_type<true> src({1, 2, 3, 4, 5, 6}, counting_allocator<int, true>(1, &src_live)),
+								dst({7, 8}, counting_allocator<int, true>(2, &dst_live));
+		const int* front = &src.front();
+
+		dst = std::move(src);
+
+		// The nodes of `dst` were freed and those of `src` were taken along with its allocator
+		EXPECT_EQ(dst_live, 0);
+		EXPECT_EQ(dst.get_allocator().id, 1);
+		EXPECT_EQ(&dst.front(), front);
+		EXPECT_EQ(dst, counted_list_type<true>({1, 2, 3, 4, 5, 6}, counting_allocator<int, true>(1, &src_live)));
+		EXPECT_TRUE(src.empty());
+	}
+
+	EXPECT_EQ(src_live, 0);
+	EXPECT_EQ(dst_live, 0);
+}
+
+TEST(unrolled_singly_list__operators, move_assignment__equal_allocator) {
+	int live = 0;
+	counting_allocator<int, false> allocator(1, &live);
+	counted_list_type<false> src({1, 2, 3, 4, 5, 6}, allocator),
+							 dst({7, 8}, allocator);
+	const int* front = &src.front();
+
+	dst = std::move(src);
+
+	EXPECT_EQ(&dst.front(), front);
+	EXPECT_EQ(dst.size(), 6);
+	EXPECT_TRUE(src.empty());
+}
+
+TEST(unrolled_singly_list__operators, move_assignment__unequal_allocator__moves_elements) {
+	int src_live = 0,
+		dst_live = 0;
+	{
+		counted_list_type<false> src({1, 2, 3, 4, 5, 6}, counting_allocator<int, false>(1, &src_live)),
+								 dst({7, 8}, counting_allocator<int, false>(2, &dst_live));
+		const int* front = &src.front();
+		std::vector<int> matcher = {1, 2, 3, 4, 5, 6};
+
+		dst = std::move(src);
+
+		// The allocator does not propagate, so the elements moved into nodes from `dst`'s allocator
+		EXPECT_EQ(dst.get_allocator().id, 2);
+		EXPECT_NE(&dst.front(), front);
+		EXPECT_EQ(src_live, 0);
+		EXPECT_EQ(dst_live, 2);
+		EXPECT_TRUE(std::equal(dst.begin(), dst.end(), matcher.begin(), matcher.end()));
+		EXPECT_TRUE(src.empty());
+	}
+
+	// Every node was freed by the allocator that created it
+	EXPECT_EQ(src_live, 0);
+	EXPECT_EQ(dst_live, 0);
+}
+
+TEST(unrolled_singly_list__operators, copy_assignment__propagating_allocator) {
+	int src_live = 0,
+		dst_live = 0;
+	{
+		counted_list_type<true> src({1, 2, 3, 4, 5, 6}, counting_allocator<int, true>(1, &src_live)),
+								dst({7, 8}, counting_allocator<int, true>(2, &dst_live));
+
+		dst = src;
+
+		EXPECT_EQ(dst.get_allocator().id, 1);
+		EXPECT_EQ(dst_live, 0);
+		EXPECT_EQ(src_live, 4);
+		EXPECT_EQ(dst, src);
+	}
+
+	EXPECT_EQ(src_live, 0);
+	EXPECT_EQ(dst_live, 0);
+}
+
+TEST(unrolled_singly_list__operators, copy_assignment__non_propagating_allocator) {
+	int src_live = 0,
+		dst_live = 0;
+	counted_list_type<false> src({1, 2, 3, 4, 5, 6}, counting_allocator<int, false>(1, &src_live)),
+							 dst({7, 8}, counting_allocator<int, false>(2, &dst_live));
+
+	dst = src;
+
+	EXPECT_EQ(dst.get_allocator().id, 2);
+	EXPECT_EQ(dst_live, 2);
+	EXPECT_EQ(dst, src);
+}
+
+/* ------------------------------------Unrolled Singly List Methods Tests------------------------------------ */
+TEST(unrolled_singly_list__methods, push_back__fills_nodes) {
+	list_type list;
+	int value = 0;
+
+	for (int i = 0; i < 100; i++) {
+		list.push_back(i);
+	}
+
+	EXPECT_EQ(list.size(), 100);
+	EXPECT_EQ(list.back(), 99);
+
+	for (int element : list) {
+		EXPECT_EQ(element, value++);
+	}
+
+	// Appends fill each node before starting the next, so elements 0..3 share a node
+	EXPECT_EQ(&*(list.begin() + 3), &list.front() + 3);
+}
+
+TEST(unrolled_singly_list__methods, push_front) {
+	list_type list;
+	std::vector<int> matcher = {5, 4, 3, 2, 1, 0};
+
+	for (int i = 0; i < 6; i++) {
+		list.push_front(i);
+	}
+
+	EXPECT_EQ(list.size(), 6);
+	EXPECT_TRUE(std::equal(list.begin(), list.end(), matcher.begin(), matcher.end()));
+}
+
+TEST(unrolled_singly_list__methods, insert_after__splits_full_node) {
+	list_type list = {1, 2, 3, 4};
+	list_type::iterator it;
+	std::vector<int> matcher = {1, 2, 10, 3, 4};
+
+	EXPECT_NO_THROW(it = list.insert_after(list.cbegin() + 1, 10));
+
+	EXPECT_EQ(*it, 10);
+	EXPECT_EQ(list.size(), 5);
+	EXPECT_TRUE(std::equal(list.begin(), list.end(), matcher.begin(), matcher.end()));
+	EXPECT_EQ(list.back(), 4);
+}
+
+TEST(unrolled_singly_list__methods, insert_after__element_of_full_node) {
+	adt::unrolled_singly_list<std::string, 4> list = {"a", "b", "c", "d"};
+	std::vector<std::string> matcher = {"a", "d", "b", "c", "d"};
+
+	// "d" is in the upper half of the full node, which the insertion splits off
+	list.insert_after(list.cbegin(), *(list.begin() + 3));
+
+	EXPECT_TRUE(std::equal(list.begin(), list.end(), matcher.begin(), matcher.end()));
+
+	list.emplace_after(list.cbegin() + 4, list.front());
+	EXPECT_EQ(list.back(), "a");
+	EXPECT_EQ(list.size(), 6);
+}
+
+TEST(unrolled_singly_list__methods, insert_after__segmentation_fault) {
+	list_type list;
+
+	EXPECT_THROW(list.insert_after(list.cend(), 1), std::runtime_error);
+}
+
+TEST(unrolled_singly_list__methods, insert_after__different_instance) {
+	list_type list, other;
+
+	EXPECT_THROW(list.insert_after(other.cbefore_begin(), 1), std::invalid_argument);
+}
+
+TEST(unrolled_singly_list__methods, insert_after__initializer_list) {
+	list_type list = {1, 6};
+	list_type::iterator it;
+	std::vector<int> matcher = {1, 2, 3, 4, 5, 6};
+
+	EXPECT_NO_THROW(it = list.insert_after(list.cbegin(), {2, 3, 4, 5}));
+
+	EXPECT_EQ(*it, 5);
+	EXPECT_TRUE(std::equal(list.begin(), list.end(), matcher.begin(), matcher.end()));
+}
+
+TEST(unrolled_singly_list__methods, emplace_after__move_only) {
+	adt::unrolled_singly_list<std::unique_ptr<int>, 2> list;
+
+	list.emplace_after(list.cbefore_begin(), std::make_unique<int>(2));
+	list.emplace_after(list.cbefore_begin(), std::make_unique<int>(1));
+	list.emplace_after(list.cbegin() + 1, std::make_unique<int>(3));
+
+	EXPECT_EQ(list.size(), 3);
+	EXPECT_EQ(*list.front(), 1);
+	EXPECT_EQ(**(list.begin() + 1), 2);
+	EXPECT_EQ(*list.back(), 3);
+}
+
+TEST(unrolled_singly_list__methods, erase_after__single) {
+	list_type list = {1, 2, 3, 4, 5, 6, 7, 8};
+	list_type::iterator it;
+	std::vector<int> matcher = {1, 2, 3, 5, 6, 7, 8};
+
+	EXPECT_NO_THROW(it = list.erase_after(list.cbegin() + 2));
+
+	EXPECT_EQ(*it, 5);
+	EXPECT_EQ(list.size(), 7);
+	EXPECT_TRUE(std::equal(list.begin(), list.end(), matcher.begin(), matcher.end()));
+}
+
+TEST(unrolled_singly_list__methods, erase_after__every_element) {
+	list_type list = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+	while (!list.empty()) {
+		EXPECT_NO_THROW(list.erase_after(list.cbefore_begin()));
+	}
+
+	EXPECT_EQ(list.begin(), list.end());
+	EXPECT_THROW(list.erase_after(list.cbefore_begin()), std::runtime_error);
+
+	list.push_back(1);
+	EXPECT_EQ(list.front(), 1);
+	EXPECT_EQ(list.back(), 1);
+}
+
+TEST(unrolled_singly_list__methods, erase_after__range) {
+	list_type list = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+	list_type::iterator it;
+	std::vector<int> matcher = {1, 2, 9, 10};
+
+	EXPECT_NO_THROW(it = list.erase_after(list.cbegin() + 1, list.cbegin() + 8));
+
+	EXPECT_EQ(*it, 9);
+	EXPECT_EQ(list.size(), 4);
+	EXPECT_TRUE(std::equal(list.begin(), list.end(), matcher.begin(), matcher.end()));
+	EXPECT_EQ(list.back(), 10);
+}
+
+TEST(unrolled_singly_list__methods, splice_after__list) {
+	list_type list = {1, 2, 7, 8},
+			  other = {3, 4, 5, 6};
+	std::vector<int> matcher = {1, 2, 3, 4, 5, 6, 7, 8};
+
+	EXPECT_NO_THROW(list.splice_after(list.cbegin() + 1, other));
+
+	EXPECT_EQ(list.size(), 8);
+	EXPECT_TRUE(other.empty());
+	EXPECT_TRUE(std::equal(list.begin(), list.end(), matcher.begin(), matcher.end()));
+	EXPECT_EQ(list.back(), 8);
+}
+
+TEST(unrolled_singly_list__methods, splice_after__list__same_instance) {
+	list_type list = {1, 2, 3};
+
+	EXPECT_THROW(list.splice_after(list.cbegin(), list), std::invalid_argument);
+}
+
+TEST(unrolled_singly_list__methods, splice_after__iterator) {
+	list_type list = {1, 2, 3},
+			  other = {4, 5, 6, 7, 8};
+	std::vector<int> matcher = {1, 2, 3, 6},
+					 other_matcher = {4, 5, 7, 8};
+
+	EXPECT_NO_THROW(list.splice_after(list.cbegin() + 2, other, other.cbegin() + 1));
+
+	EXPECT_EQ(list.size(), 4);
+	EXPECT_EQ(other.size(), 4);
+	EXPECT_TRUE(std::equal(list.begin(), list.end(), matcher.begin(), matcher.end()));
+	EXPECT_TRUE(std::equal(other.begin(), other.end(), other_matcher.begin(), other_matcher.end()));
+	EXPECT_EQ(list.back(), 6);
+}
+
+TEST(unrolled_singly_list__methods, splice_after__iterator_range) {
+	list_type list = {1, 2, 3, 4, 5, 6},
+			  other = {10, 11, 12, 13, 14, 15, 16, 17, 18};
+	std::vector<int> matcher = {1, 2, 3, 12, 13, 14, 15, 16, 4, 5, 6},
+					 other_matcher = {10, 11, 17, 18};
+
+	EXPECT_NO_THROW(list.splice_after(list.cbegin() + 2, other, other.cbegin() + 1, other.cbegin() + 7));
+
+	EXPECT_EQ(list.size(), 11);
+	EXPECT_EQ(other.size(), 4);
+	EXPECT_TRUE(std::equal(list.begin(), list.end(), matcher.begin(), matcher.end()));
+	EXPECT_TRUE(std::equal(other.begin(), other.end(), other_matcher.begin(), other_matcher.end()));
+	EXPECT_EQ(list.back(), 6);
+	EXPECT_EQ(other.back(), 18);
+}
+
+TEST(unrolled_singly_list__methods, splice_after__iterator_range__to_end) {
+	list_type list = {1, 2},
+			  other = {3, 4, 5, 6, 7};
+	std::vector<int> matcher = {1, 2, 4, 5, 6, 7},
+					 other_matcher = {3, 8};
+
+	EXPECT_NO_THROW(list.splice_after(list.cbegin() + 1, other, other.cbegin(), other.cend()));
+
+	EXPECT_TRUE(std::equal(list.begin(), list.end(), matcher.begin(), matcher.end()));
+	EXPECT_EQ(list.back(), 7);
+
+	other.push_back(8);
+	EXPECT_TRUE(std::equal(other.begin(), other.end(), other_matcher.begin(), other_matcher.end()));
+}
+
+TEST(unrolled_singly_list__methods, splice_after__unequal_allocator__moves_elements) {
+	int list_live = 0,
+		other_live = 0;
+	{
+		counted_list_type<false> list({1, 2}, counting_allocator<int, false>(1, &list_live)),
+								 other({3, 4, 5, 6, 7, 8, 9}, counting_allocator<int, false>(2, &other_live));
+		std::vector<int> matcher = {1, 3, 4, 5, 6, 2},
+						 other_matcher = {7, 8, 9};
+
+		list.splice_after(list.cbegin(), other, other.cbegin(), other.cbegin() + 4);
+		list.splice_after(list.cbegin(), other, other.cbefore_begin());
+		EXPECT_EQ(list.size(), 6);
+		EXPECT_EQ(other.size(), 3);
+		EXPECT_TRUE(std::equal(list.begin(), list.end(), matcher.begin(), matcher.end()));
+		EXPECT_TRUE(std::equal(other.begin(), other.end(), other_matcher.begin(), other_matcher.end()));
+
+		list.splice_after(list.cbefore_begin(), other);
+		EXPECT_EQ(list.front(), 7);
+		EXPECT_EQ(list.size(), 9);
+		EXPECT_TRUE(other.empty());
+	}
+
+	// Every node was freed by the allocator that created it
+	EXPECT_EQ(list_live, 0);
+	EXPECT_EQ(other_live, 0);
+}
+
+TEST(unrolled_singly_list__methods, pop_front) {
+	list_type list = {1, 2, 3, 4, 5};
+
+	for (int i = 1; i <= 5; i++) {
+		EXPECT_EQ(list.front(), i);
+		EXPECT_NO_THROW(list.pop_front());
+	}
+
+	EXPECT_TRUE(list.empty());
+	EXPECT_THROW(list.pop_front(), std::runtime_error);
+}
+
+TEST(unrolled_singly_list__methods, strings) {
+	adt::unrolled_singly_list<std::string, 3> list;
+
+	for (int i = 0; i < 20; i++) {
+		list.push_front("element__" + std::to_string(i));
+	}
+	for (int i = 0; i < 10; i++) {
+		list.erase_after(list.cbegin());
+	}
+
+	EXPECT_EQ(list.size(), 10);
+	EXPECT_EQ(list.front(), "element__19");
+	EXPECT_EQ(list.back(), "element__0");
+}
+
+TEST(unrolled_singly_list__methods, swap__propagating_allocator) {
+	int lhs_live = 0,
+		rhs_live = 0;
+	{
+		counted_list_type<true> lhs({1, 2, 3, 4, 5}, counting_allocator<int, true>(1, &lhs_live)),
+								rhs({6}, counting_allocator<int, true>(2, &rhs_live));
+
+		lhs.swap(rhs);
+
+		EXPECT_EQ(lhs.get_allocator().id, 2);
+		EXPECT_EQ(rhs.get_allocator().id, 1);
+		EXPECT_EQ(lhs.front(), 6);
+		EXPECT_EQ(rhs.size(), 5);
+	}
+
+	// Each list freed its nodes through the allocator that created them
+	EXPECT_EQ(lhs_live, 0);
+	EXPECT_EQ(rhs_live, 0);
+}
@@ -0,0 +1,155 @@
+#ifndef WORK_STEALING_LIST_HPP
+#define WORK_STEALING_LIST_HPP
+
+#include <cstddef>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+
+#include "singly_list.hpp"
+
+
+namespace adt {
+
+    // A per-worker task list for work-stealing schedulers. The owning worker pushes and pops at the front, so it
+    // always runs its most recent (cache-hot) tasks first; other workers steal the back half, i.e. the oldest tasks,
+    // by relinking nodes. Every operation holds a spin lock for a handful of pointer updates, except steal_half(),
+    // which walks to the middle of the list. Thieves never wait: a busy list simply yields nothing
+    template<class T, class Allocator = std::allocator<T>>
+    class work_stealing_list {
+    public:
+        /* -----------------------------------------------Definitions----------------------------------------------- */
+        using value_type = T;
+
+        using allocator_type = Allocator;
+
+        using size_type = std::size_t;
+
+        using reference = value_type&;
+
+        using const_reference = const value_type&;
+
+        using list_type = singly_list<T, Allocator>;
+
+    private:
+        /* -----------------------------------------------Spin Lock------------------------------------------------- */
+        class _SpinLock {
+        private:
+            /* --------------------------------------------Fields--------------------------------------------------- */
+            std::atomic<bool> locked = false;
+
+        public:
+            /* --------------------------------------------Methods-------------------------------------------------- */
+            void lock() noexcept {
+                while (this->locked.exchange(true, std::memory_order_acquire)) {
+                    // Wait on a plain load, which keeps the cache line shared until the holder releases it
+                    while (this->locked.load(std::memory_order_relaxed)) {
+                        std::this_thread::yield();
+                    }
+                }
+            }
+
+            [[nodiscard]] bool try_lock() noexcept {
+                return !this->locked.load(std::memory_order_relaxed)
+                       && !this->locked.exchange(true, std::memory_order_acquire);
+            }
+
+            void unlock() noexcept { this->locked.store(false, std::memory_order_release); }
+
+        };
+
+        /* ------------------------------------------------Fields--------------------------------------------------- */
+        _SpinLock lock;
+
+        // Mirrors list.size() so that thieves can pick a victim without taking its lock
+        std::atomic<size_type> count;
+
+        list_type list;
+
+    public:
+        /* ----------------------------------------------Constructors----------------------------------------------- */
+        work_stealing_list() : work_stealing_list(allocator_type()) {}
+
+        explicit work_stealing_list(const allocator_type& allocator) : count(0), list(allocator) {}
+
+        work_stealing_list(const work_stealing_list&) = delete;
+
+        work_stealing_list(work_stealing_list&&) = delete;
+
+        /* -----------------------------------------------Destructor------------------------------------------------ */
+        ~work_stealing_list() noexcept = default;
+
+        /* ------------------------------------------Overloaded Operators------------------------------------------- */
+        work_stealing_list& operator=(const work_stealing_list&) = delete;
+
+        work_stealing_list& operator=(work_stealing_list&&) = delete;
+
+        /* ------------------------------------------------Methods-------------------------------------------------- */
+        [[nodiscard]] allocator_type get_allocator() const noexcept { return this->list.get_allocator(); }
+
+        // Snapshots: other threads may push, pop or steal right after they are taken
+        [[nodiscard]] size_type size() const noexcept { return this->count.load(std::memory_order_relaxed); }
+
+        [[nodiscard]] bool empty() const noexcept { return this->size() == 0; }
+
+        void push_front(const_reference value) { this->emplace_front(value); }
+
+        void push_front(value_type&& value) { this->emplace_front(std::move(value)); }
+
+        template<class... Args>
+        void emplace_front(Args&&... args) {
+            std::lock_guard<_SpinLock> guard(this->lock);
+            this->list.emplace_front(std::forward<Args>(args)...);
+            this->count.store(this->list.size(), std::memory_order_relaxed);
+        }
+
+        // Links every element of `values` (e.g. a batch returned by another list's steal_half()) in front of the
+        // list, in order, without allocating
+        void splice_front(list_type&& values) {
+            std::lock_guard<_SpinLock> guard(this->lock);
+            this->list.splice_after(this->list.cbefore_begin(), std::move(values));
+            this->count.store(this->list.size(), std::memory_order_relaxed);
+        }
+
+        // Removes the front element and returns it, or returns nothing if the list is empty
+        std::optional<value_type> pop_front() {
+            // Skip the lock when there is obviously nothing to pop
+            if (this->empty()) {
+                return std::nullopt;
+            }
+
+            std::lock_guard<_SpinLock> guard(this->lock);
+            if (this->list.empty()) {
+                return std::nullopt;
+            }
+
+            std::optional<value_type> value(std::move(this->list.front()));
+            this->list.pop_front();
+            this->count.store(this->list.size(), std::memory_order_relaxed);
+
+            return value;
+        }
+
+        // Takes the back half of the list (rounded up, so a single element can be stolen too), in order. Returns an
+        // empty list if there is nothing to steal or if another thread is using the list
+        list_type steal_half() {
+            if (this->empty() || !this->lock.try_lock()) {
+                return list_type(this->list.get_allocator());
+            }
+
+            std::lock_guard<_SpinLock> guard(this->lock, std::adopt_lock);
+            list_type stolen = this->list._split_back((this->list.size() + 1) / 2);
+            this->count.store(this->list.size(), std::memory_order_relaxed);
+
+            return stolen;
+        }
+
+    };
+
+} // adt
+
+
+#endif // WORK_STEALING_LIST_HPP
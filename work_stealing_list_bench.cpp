@@ -0,0 +1,144 @@
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "work_stealing_list.hpp"
+#include "singly_list.hpp"
+
+
+/* -------------------------------------------Definitions---------------------------------------------------- */
+// Every task is the depth of its subtree: running a task of depth `d > 0` spawns two tasks of depth `d - 1`, so a root
+// of depth 15 makes 2^16 - 1 fine-grained tasks
+using task_type = int;
+
+constexpr task_type root_depth = 15;
+
+constexpr std::int64_t task_count = (std::int64_t(1) << (root_depth + 1)) - 1;
+
+// Baseline: a single singly_list behind a mutex, shared by every worker
+class locked_scheduler {
+private:
+	std::mutex mutex;
+
+	adt::singly_list<task_type> list;
+
+public:
+	explicit locked_scheduler(std::size_t) {}
+
+	void push(std::size_t, task_type task) {
+		std::lock_guard<std::mutex> lock(this->mutex);
+		this->list.push_front(task);
+	}
+
+	std::optional<task_type> pop(std::size_t) {
+		std::lock_guard<std::mutex> lock(this->mutex);
+		if (this->list.empty()) {
+			return std::nullopt;
+		}
+
+		task_type task = this->list.front();
+		this->list.pop_front();
+		return task;
+	}
+};
+
+// One work_stealing_list per worker; an idle worker steals half of a random victim's tasks
+class stealing_scheduler {
+private:
+	std::vector<std::unique_ptr<adt::work_stealing_list<task_type>>> lists;
+
+	// Per-worker xorshift state, only touched by its own worker
+	std::vector<std::uint32_t> seeds;
+
+public:
+	explicit stealing_scheduler(std::size_t worker_count) : seeds(worker_count) {
+		for (std::size_t i = 0; i < worker_count; i++) {
+			this->lists.push_back(std::make_unique<adt::work_stealing_list<task_type>>());
+			this->seeds[i] = static_cast<std::uint32_t>(i) * 2654435761u + 1;
+		}
+	}
+
+	void push(std::size_t worker, task_type task) { this->lists[worker]->push_front(task); }
+
+	std::optional<task_type> pop(std::size_t worker) {
+		if (std::optional<task_type> task = this->lists[worker]->pop_front()) {
+			return task;
+		}
+		if (this->lists.size() == 1) {
+			return std::nullopt;
+		}
+
+		std::uint32_t& seed = this->seeds[worker];
+		seed ^= seed << 13;
+		seed ^= seed >> 17;
+		seed ^= seed << 5;
+
+		const std::size_t victim = seed % this->lists.size();
+		if (victim != worker) {
+			this->lists[worker]->splice_front(this->lists[victim]->steal_half());
+		}
+
+		return this->lists[worker]->pop_front();
+	}
+};
+
+/* ---------------------------------------------Helpers------------------------------------------------------ */
+// Runs the task tree on `worker_count` workers. `pending` counts the tasks spawned but not run yet, so the workers
+// stop once it drops to zero
+template<class Scheduler>
+static void run_tree(std::size_t worker_count) {
+	Scheduler scheduler(worker_count);
+	std::atomic<std::int64_t> pending = 1;
+	std::vector<std::thread> workers;
+
+	scheduler.push(0, root_depth);
+
+	auto work = [&](std::size_t worker) -> void {
+		while (pending.load(std::memory_order_acquire) != 0) {
+			std::optional<task_type> task = scheduler.pop(worker);
+			if (!task) {
+				std::this_thread::yield();
+				continue;
+			}
+
+			if (*task > 0) {
+				pending.fetch_add(2, std::memory_order_relaxed);
+				scheduler.push(worker, *task - 1);
+				scheduler.push(worker, *task - 1);
+			}
+			benchmark::DoNotOptimize(*task);
+			pending.fetch_sub(1, std::memory_order_release);
+		}
+	};
+
+	for (std::size_t i = 1; i < worker_count; i++) {
+		workers.emplace_back(work, i);
+	}
+	work(0);
+
+	for (std::thread& worker : workers) {
+		worker.join();
+	}
+}
+
+/* ------------------------------------------Scheduler Benchmarks-------------------------------------------- */
+template<class Scheduler>
+static void bench_scheduler(benchmark::State& state) {
+	const std::size_t worker_count = static_cast<std::size_t>(state.range(0));
+
+	for (auto _ : state) {
+		run_tree<Scheduler>(worker_count);
+	}
+
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * task_count);
+}
+BENCHMARK(bench_scheduler<stealing_scheduler>)->Name("scheduler<adt::work_stealing_list>")
+	->ArgName("workers")->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_scheduler<locked_scheduler>)->Name("scheduler<mutex + adt::singly_list>")
+	->ArgName("workers")->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime()->Unit(benchmark::kMillisecond);
@@ -0,0 +1,164 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <memory> // to test move-only elements
+#include <vector>
+#include <thread>
+#include <atomic>
+
+#include "work_stealing_list.hpp"
+
+
+/* -------------------------------------------Definitions---------------------------------------------------- */
+using list_type = adt::work_stealing_list<int>;
+
+/* ------------------------------Work Stealing List Single-Threaded Tests------------------------------------ */
+TEST(work_stealing_list__methods, default_constructor) {
+	list_type list;
+
+	EXPECT_TRUE(list.empty());
+	EXPECT_EQ(list.size(), 0);
+	EXPECT_EQ(list.pop_front(), std::nullopt);
+	EXPECT_TRUE(list.steal_half().empty());
+}
+
+TEST(work_stealing_list__methods, push_front__pop_front) {
+	list_type list;
+
+	for (int i = 0; i < 5; i++) {
+		list.push_front(i);
+	}
+	EXPECT_EQ(list.size(), 5);
+
+	// The owner runs its most recent task first
+	for (int i = 4; i >= 0; i--) {
+		EXPECT_EQ(list.pop_front(), i);
+	}
+
+	EXPECT_TRUE(list.empty());
+	EXPECT_EQ(list.pop_front(), std::nullopt);
+}
+
+TEST(work_stealing_list__methods, steal_half__back_half) {
+	list_type list;
+
+	for (int i = 0; i < 7; i++) {
+		list.push_front(i);
+	}
+
+	// Thieves take the oldest tasks, rounded up
+	adt::singly_list<int> stolen = list.steal_half();
+
+	EXPECT_EQ(stolen.size(), 4);
+	EXPECT_EQ(stolen.front(), 3);
+	EXPECT_EQ(stolen.back(), 0);
+
+	EXPECT_EQ(list.size(), 3);
+	EXPECT_EQ(list.pop_front(), 6);
+	EXPECT_EQ(list.pop_front(), 5);
+	EXPECT_EQ(list.pop_front(), 4);
+	EXPECT_TRUE(list.empty());
+
+	// The stolen chain is a regular singly_list
+	stolen.push_back(-1);
+	EXPECT_EQ(stolen.back(), -1);
+	EXPECT_EQ(stolen.size(), 5);
+}
+
+TEST(work_stealing_list__methods, steal_half__single_element) {
+	list_type list;
+	list.push_front(1);
+
+	adt::singly_list<int> stolen = list.steal_half();
+
+	EXPECT_EQ(stolen.size(), 1);
+	EXPECT_EQ(stolen.front(), 1);
+	EXPECT_TRUE(list.empty());
+
+	// The victim stays usable once emptied
+	list.push_front(2);
+	EXPECT_EQ(list.pop_front(), 2);
+}
+
+TEST(work_stealing_list__methods, splice_front) {
+	list_type victim,
+			  thief;
+
+	for (int i = 0; i < 4; i++) {
+		victim.push_front(i);
+	}
+	thief.push_front(10);
+
+	thief.splice_front(victim.steal_half());
+
+	EXPECT_EQ(thief.size(), 3);
+	EXPECT_EQ(thief.pop_front(), 1);
+	EXPECT_EQ(thief.pop_front(), 0);
+	EXPECT_EQ(thief.pop_front(), 10);
+	EXPECT_EQ(victim.size(), 2);
+}
+
+TEST(work_stealing_list__methods, emplace_front__move_only) {
+	adt::work_stealing_list<std::unique_ptr<int>> list;
+
+	list.emplace_front(std::make_unique<int>(1));
+	list.push_front(std::make_unique<int>(2));
+
+	std::optional<std::unique_ptr<int>> value = list.pop_front();
+	ASSERT_TRUE(value.has_value());
+	EXPECT_EQ(**value, 2);
+	EXPECT_EQ(*list.steal_half().front(), 1);
+}
+
+/* -------------------------------Work Stealing List Multi-Threaded Tests------------------------------------ */
+TEST(work_stealing_list__threads, owner_and_thieves) {
+	constexpr int task_count = 100'000,
+				  thief_count = 3;
+	list_type owner;
+	std::atomic<long long> sum = 0;
+	std::atomic<int> done = 0;
+	std::atomic<bool> pushed = false;
+	std::vector<std::thread> threads;
+
+	// The owner pushes every task, popping one now and then
+	threads.emplace_back([&]() {
+		for (int i = 0; i < task_count; i++) {
+			owner.push_front(i);
+
+			if (i % 4 == 0) {
+				if (std::optional<int> value = owner.pop_front()) {
+					sum += *value;
+					done++;
+				}
+			}
+		}
+		pushed = true;
+
+		while (std::optional<int> value = owner.pop_front()) {
+			sum += *value;
+			done++;
+		}
+	});
+
+	// Each thief steals into a list of its own and runs what it stole
+	for (int t = 0; t < thief_count; t++) {
+		threads.emplace_back([&]() {
+			list_type own;
+
+			while (!pushed || !owner.empty()) {
+				own.splice_front(owner.steal_half());
+
+				while (std::optional<int> value = own.pop_front()) {
+					sum += *value;
+					done++;
+				}
+			}
+		});
+	}
+	for (std::thread& thread : threads) {
+		thread.join();
+	}
+
+	EXPECT_EQ(done, task_count);
+	EXPECT_EQ(sum, static_cast<long long>(task_count) * (task_count - 1) / 2);
+}